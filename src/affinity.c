@@ -0,0 +1,250 @@
+/*
+ * This file is part of John the Ripper password cracker.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted.
+ *
+ * There's ABSOLUTELY NO WARRANTY, express or implied.
+ */
+
+#define _GNU_SOURCE 1 /* for sched_setaffinity() */
+#include "os.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if __linux__
+#include <sched.h>
+#include <dirent.h>
+#endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "arch.h"
+#include "misc.h"
+#include "params.h"
+#include "memory.h"
+#include "options.h"
+#include "logger.h"
+#include "affinity.h"
+
+#define AFFINITY_SYSFS			"/sys/devices/system/cpu/cpu%d"
+
+static int pin_requested, pin_cores, pinned;
+
+void affinity_init(void)
+{
+	if (!options.pin || options.pin == OPT_TRISTATE_NEGATED)
+		return;
+
+	pin_requested = 1;
+	if (options.pin != OPT_TRISTATE_NO_PARAM) {
+		if (!strcasecmp(options.pin, "cores"))
+			pin_cores = 1;
+		else if (strcasecmp(options.pin, "all"))
+			error_msg("Allowed arguments to --pin are all or cores\n");
+	}
+}
+
+int affinity_pinned(void)
+{
+	return pinned;
+}
+
+#if __linux__ && defined(CPU_SETSIZE)
+struct affinity_cpu {
+	int cpu, node, package, core;
+	int core_index, sibling;
+};
+
+static struct affinity_cpu *cpus;
+static int cpu_count, core_count, max_siblings;
+
+static int affinity_read_int(int cpu, const char *name, int fallback)
+{
+	FILE *file;
+	char path[PATH_BUFFER_SIZE];
+	int value;
+
+	snprintf(path, sizeof(path), AFFINITY_SYSFS "/topology/%s", cpu, name);
+	if (!(file = fopen(path, "r")))
+		return fallback;
+	if (fscanf(file, "%d", &value) != 1)
+		value = fallback;
+	fclose(file);
+
+	return value;
+}
+
+static int affinity_read_node(int cpu)
+{
+	DIR *dir;
+	struct dirent *entry;
+	char path[PATH_BUFFER_SIZE];
+	int node = 0;
+
+	snprintf(path, sizeof(path), AFFINITY_SYSFS, cpu);
+	if (!(dir = opendir(path)))
+		return 0;
+
+	while ((entry = readdir(dir)))
+		if (!strncmp(entry->d_name, "node", 4) &&
+		    sscanf(entry->d_name + 4, "%d", &node) == 1)
+			break;
+
+	closedir(dir);
+
+	return node;
+}
+
+static int affinity_compare(const void *a, const void *b)
+{
+	const struct affinity_cpu *x = a, *y = b;
+
+	if (x->node != y->node)
+		return x->node - y->node;
+	if (x->package != y->package)
+		return x->package - y->package;
+	if (x->core != y->core)
+		return x->core - y->core;
+	return x->cpu - y->cpu;
+}
+
+/*
+ * Reads what CPUs we may use and how they group into cores, sorted by node,
+ * package and core.  Without topology info, each CPU is a core of its own.
+ */
+static void affinity_read_topology(void)
+{
+	cpu_set_t allowed;
+	int cpu, i;
+
+	if (cpus || sched_getaffinity(0, sizeof(allowed), &allowed) ||
+	    !(cpu_count = CPU_COUNT(&allowed)))
+		return;
+
+	cpus = mem_calloc_tiny(cpu_count * sizeof(*cpus), MEM_ALIGN_WORD);
+	for (i = 0, cpu = 0; cpu < CPU_SETSIZE && i < cpu_count; cpu++) {
+		if (!CPU_ISSET(cpu, &allowed))
+			continue;
+		cpus[i].cpu = cpu;
+		cpus[i].node = affinity_read_node(cpu);
+		cpus[i].package =
+			affinity_read_int(cpu, "physical_package_id", 0);
+		cpus[i].core = affinity_read_int(cpu, "core_id", cpu);
+		i++;
+	}
+
+	qsort(cpus, cpu_count, sizeof(*cpus), affinity_compare);
+
+	for (i = 0; i < cpu_count; i++) {
+		if (i && cpus[i].node == cpus[i - 1].node &&
+		    cpus[i].package == cpus[i - 1].package &&
+		    cpus[i].core == cpus[i - 1].core) {
+			cpus[i].core_index = cpus[i - 1].core_index;
+			cpus[i].sibling = cpus[i - 1].sibling + 1;
+		} else
+			cpus[i].core_index = core_count++;
+		if (cpus[i].sibling >= max_siblings)
+			max_siblings = cpus[i].sibling + 1;
+	}
+}
+
+int affinity_threads(void)
+{
+	if (!pin_cores)
+		return 0;
+
+	affinity_read_topology();
+
+	return core_count;
+}
+
+/*
+ * Lists the CPUs of share index out of count: first thread of each of its
+ * cores, then each core's second, and so on.  Returns how many.
+ */
+static int affinity_share(int index, int count, int *list)
+{
+	int first = (long long)index * core_count / count;
+	int last = (long long)(index + 1) * core_count / count;
+	int sibling, i, n = 0;
+
+	if (last <= first)
+		last = first + 1;
+
+	for (sibling = 0; sibling < (pin_cores ? 1 : max_siblings); sibling++)
+		for (i = 0; i < cpu_count; i++)
+			if (cpus[i].sibling == sibling &&
+			    cpus[i].core_index >= first &&
+			    cpus[i].core_index < last)
+				list[n++] = cpus[i].cpu;
+
+	return n;
+}
+
+static void affinity_log(int *list, int n)
+{
+	char buf[LINE_BUFFER_SIZE];
+	int i, len = 0;
+
+	for (i = 0; i < n && len < (int)sizeof(buf) - 16; i++)
+		len += snprintf(buf + len, sizeof(buf) - len, "%s%d",
+		                i ? "," : "", list[i]);
+	if (i < n)
+		strcpy(buf + len, ",...");
+
+	log_event("- Pinned to CPU%s %s", n > 1 ? "s" : "", buf);
+}
+
+void affinity_pin(int index, int count, int force)
+{
+	cpu_set_t set;
+	int *list, n, i;
+
+	if (!pin_requested && !force)
+		return;
+
+	affinity_read_topology();
+	if (!core_count)
+		return;
+
+	list = mem_alloc(cpu_count * sizeof(*list));
+	n = affinity_share(index, count, list);
+
+	/* Threads spawned from here on start out within our share */
+	CPU_ZERO(&set);
+	for (i = 0; i < n; i++)
+		CPU_SET(list[i], &set);
+	sched_setaffinity(0, sizeof(set), &set);
+
+#ifdef _OPENMP
+#pragma omp parallel private(set)
+	{
+		CPU_ZERO(&set);
+		CPU_SET(list[omp_get_thread_num() % n], &set);
+		sched_setaffinity(0, sizeof(set), &set);
+	}
+#else
+	CPU_ZERO(&set);
+	CPU_SET(list[0], &set);
+	sched_setaffinity(0, sizeof(set), &set);
+#endif
+
+	if (!pinned)
+		affinity_log(list, n);
+	pinned = 1;
+
+	MEM_FREE(list);
+}
+#else
+int affinity_threads(void)
+{
+	return 0;
+}
+
+void affinity_pin(int index, int count, int force)
+{
+}
+#endif
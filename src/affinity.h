@@ -0,0 +1,48 @@
+/*
+ * This file is part of John the Ripper password cracker.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted.
+ *
+ * There's ABSOLUTELY NO WARRANTY, express or implied.
+ */
+
+/*
+ * CPU placement by topology (--pin).
+ *
+ * The CPUs we may run on are grouped into physical cores, ordered by NUMA
+ * node and package.  Each --fork process gets a contiguous share of those
+ * cores, so that processes split along node boundaries where they can, and
+ * its OpenMP threads are pinned one per CPU within that share, all cores'
+ * first hardware thread before any SMT sibling.
+ *
+ * We pin right after forking, before a child touches its own buffers.  With
+ * the usual first-touch policy, the pages it allocates or copies on write
+ * then come from its own node.
+ */
+
+#ifndef _JOHN_AFFINITY_H
+#define _JOHN_AFFINITY_H
+
+/*
+ * Parses --pin.  Call before OpenMP thread counts are settled.
+ */
+extern void affinity_init(void);
+
+/*
+ * How many OpenMP threads --pin=cores asks for in total, or 0 for no change.
+ */
+extern int affinity_threads(void);
+
+/*
+ * Pins this process, number index of count, and its OpenMP threads to its
+ * share of the CPUs.  With force, do so even without --pin.
+ */
+extern void affinity_pin(int index, int count, int force);
+
+/*
+ * Whether we're pinned.
+ */
+extern int affinity_pinned(void);
+
+#endif
@@ -0,0 +1 @@
+x86-64.h
\ No newline at end of file
@@ -56,6 +56,8 @@
 
 #ifndef BENCH_BUILD
 #include "options.h"
+#include "prof.h"
+#include "benchstat.h"
 #else
 /*
  * This code was copied from loader.c.  It has been stripped to bare bones
@@ -544,6 +546,8 @@ char *benchmark_format(struct fmt_main *format, int salts,
 #ifndef BENCH_BUILD
 	if (salts <= 1)
 		two_salts_db[1] = two_salts_db[0];
+
+	prof_init(PROF_OTHER);
 #endif
 
 	index = salts;
@@ -561,18 +565,33 @@ char *benchmark_format(struct fmt_main *format, int salts,
 				if (!(++current)->ciphertext)
 					current = format->params.tests;
 			}
+#ifndef BENCH_BUILD
+			if (prof_enabled)
+				prof_switch(PROF_SET_KEY);
+#endif
 			bench_set_keys(format, current, pass);
 		}
 
+#ifndef BENCH_BUILD
+		if (prof_enabled)
+			prof_switch(PROF_CRYPT);
+#endif
 		if (salts > 1)
 			format->methods.set_salt(two_salts[index & 1]);
 #ifndef BENCH_BUILD
 		int match = format->methods.crypt_all(&count, two_salts_db[index & 1]);
+
+		if (prof_enabled)
+			prof_switch(PROF_LOOKUP);
 #else
 		int match = format->methods.crypt_all(&count, NULL);
 #endif
 		if (match)
 			format->methods.cmp_all(binary, match);
+#ifndef BENCH_BUILD
+		if (prof_enabled)
+			prof_switch(PROF_OTHER);
+#endif
 
 		crypts += (uint32_t)count;
 #if !OS_TIMER
@@ -605,6 +624,13 @@ char *benchmark_format(struct fmt_main *format, int salts,
 	results->virtual = end_virtual - start_virtual;
 	results->crypts = crypts;
 	results->salts_done = salts_done;
+	results->prof[0] = 0;
+#ifndef BENCH_BUILD
+	if (prof_enabled) {
+		prof_report(results->prof, sizeof(results->prof), crypts, "c");
+		prof_enabled = 0;
+	}
+#endif
 
 	for (index = 0; index < 2; index++) {
 		if (index == 0 || !dyna_copied)
@@ -670,6 +696,7 @@ void gather_results(struct bench_results *results)
 	MPI_Reduce(&results->salts_done, &combined.salts_done, 1, MPI_INT,
 		MPI_MIN, 0, MPI_COMM_WORLD);
 	if (mpi_id == 0) {
+		strcpy(combined.prof, results->prof);
 		combined.real /= mpi_p;
 		combined.virtual /= mpi_p;
 		memcpy(results, &combined, sizeof(struct bench_results));
@@ -677,6 +704,32 @@ void gather_results(struct bench_results *results)
 }
 #endif
 
+#ifndef BENCH_BUILD
+/*
+ * Runs benchmark_format() as many times as --bench-repeat says and leaves the
+ * median run in results.
+ */
+static char *benchmark_repeat(struct fmt_main *format, int salts,
+	struct bench_results *results, struct db_main *test_db,
+	struct bench_stats *stats)
+{
+	int count = MAX(options.bench_repeat, 1), i;
+	struct bench_results *runs;
+	char *result = NULL;
+
+	runs = mem_alloc(count * sizeof(*runs));
+	for (i = 0; i < count && !result; i++) {
+		benchstat_pin();
+		result = benchmark_format(format, salts, &runs[i], test_db);
+	}
+	if (!result)
+		benchstat_summarize(runs, count, results, stats);
+	MEM_FREE(runs);
+
+	return result;
+}
+#endif
+
 int benchmark_all(void)
 {
 	struct fmt_main *format;
@@ -712,6 +765,8 @@ int benchmark_all(void)
 		if (system("nvidia-smi --query-gpu=memory.used --format=csv,noheader"))
 			nvidia_mem = 0;
 	}
+
+	benchstat_init();
 AGAIN:
 	options.loader.field_sep_char = 31;
 #endif
@@ -723,6 +778,9 @@ AGAIN:
 		char *result, *msg_1, *msg_m;
 		struct bench_results results_1, results_m;
 		char s_real[64], s_virtual[64];
+#ifndef BENCH_BUILD
+		struct bench_stats stats_1, stats_m;
+#endif
 
 #ifndef BENCH_BUILD
 /* Silently skip formats for which we have no tests, unless forced */
@@ -944,7 +1002,12 @@ AGAIN:
 		benchmark_running = 1;
 		format->methods.reset(test_db);
 #endif
+#ifndef BENCH_BUILD
+		if ((result = benchmark_repeat(format, salts, &results_m, test_db,
+		                               &stats_m))) {
+#else
 		if ((result = benchmark_format(format, salts, &results_m, test_db))) {
+#endif
 			puts(result);
 			failed += !event_abort;
 			goto next;
@@ -978,7 +1041,12 @@ AGAIN:
 #endif
 
 		if (msg_1) {
+#ifndef BENCH_BUILD
+			if ((result = benchmark_repeat(format, 1, &results_1, test_db,
+			                               &stats_1))) {
+#else
 			if ((result = benchmark_format(format, 1, &results_1, test_db))) {
+#endif
 				puts(result);
 				failed += !event_abort;
 				goto next;
@@ -1048,6 +1116,11 @@ AGAIN:
 #endif
 				printf("%s:\t%s c/s%s\n",
 				       msg_m, s_real, s_gpu);
+			if (*results_m.prof)
+				printf("Profile:\t%s\n", results_m.prof);
+#ifndef BENCH_BUILD
+			benchstat_report(format, msg_m, &stats_m);
+#endif
 		}
 
 		if (!msg_1) {
@@ -1063,12 +1136,18 @@ AGAIN:
 		if (john_main_process && benchmark_time) {
 #if !defined(__DJGPP__) && !defined(__BEOS__) && !defined(__MINGW32__) && !defined (_MSC_VER)
 			if (results_1.virtual)
-				printf("%s:\t%s c/s real, %s c/s virtual%s\n\n",
+				printf("%s:\t%s c/s real, %s c/s virtual%s\n",
 				       msg_1, s_real, s_virtual, s_gpu1);
 			else
 #endif
-				printf("%s:\t%s c/s%s\n\n",
+				printf("%s:\t%s c/s%s\n",
 				       msg_1, s_real, s_gpu1);
+			if (*results_1.prof)
+				printf("Profile:\t%s\n", results_1.prof);
+#ifndef BENCH_BUILD
+			benchstat_report(format, msg_1, &stats_1);
+#endif
+			putchar('\n');
 		}
 
 next:
@@ -1131,5 +1210,10 @@ next:
 	}
 #endif
 
+#ifndef BENCH_BUILD
+	if (benchstat_done())
+		return 1;
+#endif
+
 	return failed || event_abort;
 }
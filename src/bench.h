@@ -33,6 +33,9 @@ struct bench_results {
 
 /* Number of salts actually tested */
 	int salts_done;
+
+/* Time breakdown with --profile, or empty */
+	char prof[160];
 };
 
 /*
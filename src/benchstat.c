@@ -0,0 +1,341 @@
+/*
+ * This file is part of John the Ripper password cracker.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted.
+ *
+ * There's ABSOLUTELY NO WARRANTY, express or implied.
+ */
+
+#include "os.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "arch.h"
+#include "simd-intrinsics.h"
+#include "misc.h"
+#include "params.h"
+#include "memory.h"
+#include "path.h"
+#include "options.h"
+#include "config.h"
+#include "formats.h"
+#include "bench.h"
+#include "john.h"
+#include "omp_autotune.h"
+#include "affinity.h"
+#include "version.h"
+#include "benchstat.h"
+
+#ifdef NO_JOHN_BLD
+#define JOHN_BLD "unk-build-type"
+#else
+#include "john_build_rule.h"
+#endif
+
+#ifndef SIMD_COEF_32
+#undef SIMD_TYPE
+#define SIMD_TYPE "none"
+#endif
+
+/* Percent below the baseline that counts as a regression */
+#define BENCHSTAT_THRESHOLD		5
+
+struct benchstat_record {
+	struct benchstat_record *next;
+	char *format, *test;
+	struct bench_stats stats;
+	int mkpc, threads, scale;
+};
+
+static int benchstat_active, benchstat_regressions;
+static double benchstat_threshold;
+static struct benchstat_record *records, **records_tail = &records;
+static struct benchstat_record *baseline;
+
+void benchstat_pin(void)
+{
+	if (benchstat_active)
+		affinity_pin(0, 1, 1);
+}
+
+/*
+ * Copies the string value for key out of a line we wrote, or returns NULL.
+ */
+static char *benchstat_get_string(const char *line, const char *key,
+	char *buffer, size_t size)
+{
+	const char *p;
+	size_t n = 0;
+
+	if (!(p = strstr(line, key)))
+		return NULL;
+
+	for (p += strlen(key); *p && *p != '"' && n < size - 1; p++) {
+		if (*p == '\\' && p[1])
+			p++;
+		buffer[n++] = *p;
+	}
+	buffer[n] = 0;
+
+	return *p == '"' ? buffer : NULL;
+}
+
+static void benchstat_read_baseline(const char *name)
+{
+	FILE *file;
+	char line[LINE_BUFFER_SIZE], format[LINE_BUFFER_SIZE], test[64];
+	const char *p;
+	double c_s;
+	int count = 0;
+
+	if (!(file = fopen(path_expand(name), "r")))
+		pexit("fopen: %s", path_expand(name));
+
+	while (fgets(line, sizeof(line), file)) {
+		struct benchstat_record *record;
+
+		if (!benchstat_get_string(line, "\"format\":\"", format,
+		                          sizeof(format)) ||
+		    !benchstat_get_string(line, "\"test\":\"", test,
+		                          sizeof(test)) ||
+		    !(p = strstr(line, "\"c_s\":")) ||
+		    sscanf(p, "\"c_s\":%lf", &c_s) != 1)
+			continue;
+
+		record = mem_calloc_tiny(sizeof(*record), MEM_ALIGN_WORD);
+		record->format = str_alloc_copy(format);
+		record->test = str_alloc_copy(test);
+		record->stats.median = c_s;
+		record->next = baseline;
+		baseline = record;
+		count++;
+	}
+
+	if (ferror(file))
+		pexit("fgets");
+	fclose(file);
+
+	if (!count)
+		error_msg("No benchmark results in %s\n", name);
+}
+
+void benchstat_init(void)
+{
+	const char *threshold;
+
+	if (!options.bench_repeat && !options.bench_json &&
+	    !options.bench_baseline)
+		return;
+
+	benchstat_active = 1;
+
+	if (!(threshold = cfg_get_param(SECTION_OPTIONS, NULL,
+	                                "BenchmarkRegressionThreshold")) ||
+	    (benchstat_threshold = atof(threshold)) <= 0)
+		benchstat_threshold = BENCHSTAT_THRESHOLD;
+
+	if (options.bench_baseline)
+		benchstat_read_baseline(options.bench_baseline);
+
+	benchstat_pin();
+}
+
+static double benchstat_cps(struct bench_results *results)
+{
+	return results->real ?
+		(double)results->crypts * clk_tck / results->real : 0;
+}
+
+void benchstat_summarize(struct bench_results *runs, int count,
+	struct bench_results *median, struct bench_stats *stats)
+{
+	double *cps = mem_alloc(count * sizeof(*cps)), sum = 0, mean, var = 0;
+	int i, j, middle;
+
+	for (i = 0; i < count; i++)
+		sum += cps[i] = benchstat_cps(&runs[i]);
+	mean = sum / count;
+
+	/* Insertion sort of the runs by speed, there won't be many */
+	for (i = 1; i < count; i++)
+		for (j = i; j > 0 && cps[j - 1] > cps[j]; j--) {
+			struct bench_results tmp = runs[j];
+			double t = cps[j];
+
+			runs[j] = runs[j - 1];
+			runs[j - 1] = tmp;
+			cps[j] = cps[j - 1];
+			cps[j - 1] = t;
+		}
+
+	for (i = 0; i < count; i++)
+		var += (cps[i] - mean) * (cps[i] - mean);
+
+	middle = (count - 1) / 2;
+	*median = runs[middle];
+
+	stats->runs = count;
+	stats->median = cps[middle];
+	stats->min = cps[0];
+	stats->max = cps[count - 1];
+	stats->stddev = (count > 1 && mean > 0) ?
+		100 * sqrt(var / (count - 1)) / mean : 0;
+
+	MEM_FREE(cps);
+}
+
+/*
+ * Like benchmark_cps(), for a rate we already have.
+ */
+static char *benchstat_rate(double cps, char *buffer)
+{
+	benchmark_cps((uint64_t)(cps * 100 + 0.5), 100 * clk_tck, buffer);
+
+	return buffer;
+}
+
+static struct benchstat_record *benchstat_find_baseline(const char *format,
+	const char *test)
+{
+	struct benchstat_record *record;
+
+	for (record = baseline; record; record = record->next)
+		if (!strcmp(record->format, format) && !strcmp(record->test, test))
+			return record;
+
+	return NULL;
+}
+
+void benchstat_report(struct fmt_main *format, const char *test,
+	struct bench_stats *stats)
+{
+	struct benchstat_record *record, *base;
+	char s_min[64], s_max[64];
+
+	if (!benchstat_active)
+		return;
+
+	if (stats->runs > 1)
+		printf("Spread:\t%d runs, min %s c/s, max %s c/s, stddev %.1f%%\n",
+		       stats->runs, benchstat_rate(stats->min, s_min),
+		       benchstat_rate(stats->max, s_max), stats->stddev);
+
+	if ((base = benchstat_find_baseline(format->params.label, test))) {
+		double change = base->stats.median > 0 ?
+			100 * (stats->median / base->stats.median - 1) : 0;
+		int regression = change < -benchstat_threshold;
+
+		benchstat_regressions += regression;
+		printf("Baseline:\t%s c/s, %+.1f%%%s\n",
+		       benchstat_rate(base->stats.median, s_min), change,
+		       regression ? " REGRESSION" : "");
+	} else if (baseline)
+		puts("Baseline:\tnone");
+
+	record = mem_calloc_tiny(sizeof(*record), MEM_ALIGN_WORD);
+	record->format = str_alloc_copy(format->params.label);
+	record->test = str_alloc_copy(test);
+	record->stats = *stats;
+	record->mkpc = format->params.max_keys_per_crypt;
+#ifdef _OPENMP
+	record->threads = (format->params.flags & FMT_OMP) ?
+		omp_get_max_threads() : 1;
+#else
+	record->threads = 1;
+#endif
+	record->scale = (format->params.flags & FMT_OMP) ?
+		omp_autotune_scale() : 1;
+	*records_tail = record;
+	records_tail = &record->next;
+}
+
+static void benchstat_put_string(FILE *file, const char *s)
+{
+	putc('"', file);
+	for (; *s; s++) {
+		if (*s == '"' || *s == '\\')
+			fprintf(file, "\\%c", *s);
+		else if ((unsigned char)*s < 0x20)
+			fprintf(file, "\\u%04x", (unsigned char)*s);
+		else
+			putc(*s, file);
+	}
+	putc('"', file);
+}
+
+static void benchstat_write_json(const char *name)
+{
+	FILE *file;
+	struct benchstat_record *record;
+	char cpu[LINE_BUFFER_SIZE], date[32];
+	time_t now = time(NULL);
+	int threads = 1;
+
+#ifdef _OPENMP
+	threads = omp_get_max_threads();
+#endif
+	strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+	if (!(file = fopen(path_expand(name), "w")))
+		pexit("fopen: %s", path_expand(name));
+
+	fputs("{\"version\":", file);
+	benchstat_put_string(file, JTR_GIT_VERSION);
+	fputs(",\"build\":", file);
+	benchstat_put_string(file, JOHN_BLD);
+	fputs(",\"simd\":", file);
+	benchstat_put_string(file, SIMD_TYPE);
+	fputs(",\"cpu\":", file);
+	benchstat_put_string(file, host_cpu_model(cpu, sizeof(cpu)));
+	fprintf(file, ",\"time\":\"%s\",\"benchmark_time\":%d,\"repeat\":%u,"
+	        "\"threads\":%d,\"pinned\":%s}\n",
+	        date, benchmark_time, MAX(options.bench_repeat, 1), threads,
+	        affinity_pinned() ? "true" : "false");
+
+	for (record = records; record; record = record->next) {
+		fputs("{\"format\":", file);
+		benchstat_put_string(file, record->format);
+		fputs(",\"test\":", file);
+		benchstat_put_string(file, record->test);
+		fprintf(file, ",\"c_s\":%.1f,\"c_s_min\":%.1f,\"c_s_max\":%.1f,"
+		        "\"stddev_pct\":%.2f,\"runs\":%d,\"mkpc\":%d,"
+		        "\"omp_threads\":%d,\"omp_scale\":%d}\n",
+		        record->stats.median, record->stats.min,
+		        record->stats.max, record->stats.stddev,
+		        record->stats.runs, record->mkpc, record->threads,
+		        record->scale);
+	}
+
+	if (ferror(file) || fclose(file))
+		pexit("%s", path_expand(name));
+}
+
+int benchstat_done(void)
+{
+	if (!benchstat_active || !john_main_process)
+		return 0;
+
+	if (options.bench_json)
+		benchstat_write_json(options.bench_json);
+
+	if (options.bench_baseline) {
+		if (benchstat_regressions)
+			printf("%d test%s regressed by more than %g%% against %s\n",
+			       benchstat_regressions,
+			       benchstat_regressions > 1 ? "s" : "",
+			       benchstat_threshold, options.bench_baseline);
+		else
+			printf("No regressions by more than %g%% against %s\n",
+			       benchstat_threshold, options.bench_baseline);
+	}
+
+	return benchstat_regressions;
+}
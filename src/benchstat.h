@@ -0,0 +1,66 @@
+/*
+ * This file is part of John the Ripper password cracker.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted.
+ *
+ * There's ABSOLUTELY NO WARRANTY, express or implied.
+ */
+
+/*
+ * Repeated benchmark runs and their machine-readable record, for --test
+ * with --bench-repeat, --bench-json and --bench-baseline.
+ *
+ * Each test of a format is run that many times with our threads pinned to
+ * CPUs, and we report the median run along with the min, max and relative
+ * standard deviation of the real c/s figures.  The results, together with
+ * what build and CPU they came from, can be written as JSON lines and later
+ * read back as a baseline to compare a new run against.
+ */
+
+#ifndef _JOHN_BENCHSTAT_H
+#define _JOHN_BENCHSTAT_H
+
+#include "formats.h"
+#include "bench.h"
+
+/*
+ * Spread of the real c/s figures over a test's runs.
+ */
+struct bench_stats {
+	int runs;
+	double median, min, max, stddev;
+};
+
+/*
+ * Reads the baseline, if any, and pins the main thread.  Does nothing
+ * unless one of the options above is used.
+ */
+extern void benchstat_init(void);
+
+/*
+ * Pins the current OpenMP threads to CPUs, one each, if benchstat_init()
+ * decided to.  See affinity.h.
+ */
+extern void benchstat_pin(void);
+
+/*
+ * Picks the median of count runs into *median and fills in *stats.  For an
+ * even count, that's the slower of the two middle runs.
+ */
+extern void benchstat_summarize(struct bench_results *runs, int count,
+	struct bench_results *median, struct bench_stats *stats);
+
+/*
+ * Prints the spread and the comparison against the baseline for one test,
+ * and records it for the JSON output.
+ */
+extern void benchstat_report(struct fmt_main *format, const char *test,
+	struct bench_stats *stats);
+
+/*
+ * Writes the JSON output and prints the regression count, which it returns.
+ */
+extern int benchstat_done(void);
+
+#endif
@@ -20,6 +20,13 @@
 #include "memory.h"
 #include "compiler.h"
 
+#if defined(__x86_64__) && HAVE_MMAP && !defined(_WIN32)
+#include <sys/mman.h>
+#ifdef MAP_ANON
+#define C_NATIVE			1
+#endif
+#endif
+
 #undef PRINT_INSNS
 
 char *c_errors[] = {
@@ -44,6 +51,8 @@ char *c_errors[] = {
 
 int c_errno;
 
+int c_native = 0;
+
 union c_insn {
 	void (*op)(void);
 	c_int *mem;
@@ -82,6 +91,15 @@ static char c_isident[0x100];
 
 static int c_EOF;
 
+#ifdef C_NATIVE
+static unsigned char *c_native_code;
+static size_t c_native_size;
+/* Native entry points by offset into c_code_start[], for function starts */
+static unsigned char **c_native_entries;
+
+static void c_native_free(void);
+#endif
+
 static int (*c_ext_getchar)(void);
 static void (*c_ext_rewind)(void);
 
@@ -362,6 +380,9 @@ static void c_free_fixup(struct c_fixup *list, union c_insn *pc)
 }
 
 void c_cleanup() {
+#ifdef C_NATIVE
+	c_native_free();
+#endif
 	MEM_FREE(c_code_start);
 	MEM_FREE(c_data_start);
 	c_free_ident(c_funcs, NULL);
@@ -881,6 +902,647 @@ static int c_block(char term, struct c_ident *vars)
 	return c_errno;
 }
 
+#ifdef C_NATIVE
+/*
+ * Native code backend for x86-64.
+ *
+ * The compiled program is a stack machine, with the top of stack cached in a
+ * register much like the threaded interpreter below does.  Since expressions
+ * never span branches, the stack is empty at every jump and jump target, so
+ * the stack depth at each instruction is known at translation time.  We thus
+ * keep a fixed pointer to c_stack[2] in r10 and address stack slots at
+ * constant offsets from it, with the top of stack in eax.  Pushes that are
+ * immediately consumed by a binary operator, comparisons feeding a branch, and
+ * simple assignment statements are translated to single instructions with
+ * immediate or memory operands.  Only caller-saved registers are used.
+ */
+enum {
+/* Must be in the same order as c_ops[] */
+	C_N_INDEX, C_N_ASSIGN, C_N_ADD_A, C_N_SUB_A, C_N_MUL_A, C_N_DIV_A,
+	C_N_MOD_A, C_N_OR_A, C_N_XOR_A, C_N_AND_A, C_N_SHL_A, C_N_SHR_A,
+	C_N_OR_L, C_N_AND_B, C_N_OR_I, C_N_XOR_I, C_N_AND_I, C_N_EQ, C_N_NE,
+	C_N_GT, C_N_LT, C_N_GE, C_N_LE, C_N_SHL, C_N_SHR, C_N_ADD, C_N_SUB,
+	C_N_MUL, C_N_DIV, C_N_MOD, C_N_NOT_B, C_N_NOT_I, C_N_NEG,
+	C_N_INC_L, C_N_DEC_L, C_N_INC_R, C_N_DEC_R,
+/* Not in c_ops[] */
+	C_N_RETURN, C_N_BZ, C_N_BA, C_N_PUSH_IMM, C_N_PUSH_MEM, C_N_POP,
+	C_N_ASSIGN_POP
+};
+
+struct c_native_insn {
+	int kind;
+/* Offset of the original instruction, or -1 for the rest of a combined push */
+	int offset;
+	union c_insn arg;
+};
+
+/* Worst case native code size per instruction, and for a function prologue */
+#define C_NATIVE_INSN_MAX		48
+#define C_NATIVE_PROLOGUE		12
+
+static unsigned char *c_n_ptr;
+
+#define C_N(...) \
+	do { \
+		static const unsigned char c_n_bytes[] = { __VA_ARGS__ }; \
+		memcpy(c_n_ptr, c_n_bytes, sizeof(c_n_bytes)); \
+		c_n_ptr += sizeof(c_n_bytes); \
+	} while (0)
+
+static void c_n_32(c_int value)
+{
+	memcpy(c_n_ptr, &value, 4);
+	c_n_ptr += 4;
+}
+
+static void c_n_64(const void *value)
+{
+	memcpy(c_n_ptr, &value, 8);
+	c_n_ptr += 8;
+}
+
+/* ModR/M and displacement for [r10 + slot * sizeof(union c_insn)] */
+static void c_n_slot(int reg, int slot)
+{
+	*c_n_ptr++ = 0x82 | (reg << 3);
+	c_n_32(slot * (int)sizeof(union c_insn));
+}
+
+/* mov rcx, addr */
+static void c_n_rcx(const void *addr)
+{
+	C_N(0x48, 0xb9);
+	c_n_64(addr);
+}
+
+static void c_native_free(void)
+{
+	if (c_native_code)
+		munmap(c_native_code, c_native_size);
+	c_native_code = NULL;
+	MEM_FREE(c_native_entries);
+}
+
+static int c_n_is_cmp(int kind)
+{
+	return kind >= C_N_EQ && kind <= C_N_LE && kind != C_N_NE;
+}
+
+/* setcc and inverse jcc (second byte of each) for the comparisons */
+static unsigned char c_n_setcc(int kind)
+{
+	switch (kind) {
+	case C_N_EQ: return 0x94;
+	case C_N_GT: return 0x9f;
+	case C_N_LT: return 0x9c;
+	case C_N_GE: return 0x9d;
+	default: return 0x9e; /* C_N_LE */
+	}
+}
+
+static unsigned char c_n_jcc_false(int kind)
+{
+	switch (kind) {
+	case C_N_EQ: return 0x85;
+	case C_N_GT: return 0x8e;
+	case C_N_LT: return 0x8d;
+	case C_N_GE: return 0x8c;
+	default: return 0x8f; /* C_N_LE */
+	}
+}
+
+/*
+ * Translate the program we've just compiled.  If anything doesn't look like
+ * what we expect, we leave it to the interpreter.
+ */
+static void c_native_compile(void)
+{
+	int size = c_code_ptr - c_code_start;
+	struct c_native_insn *insns, *insn, *next;
+	unsigned char **labels, *target, *end;
+	struct c_native_fixup {
+		unsigned char *at;
+		int target;
+	} *fixups;
+	int count, fixup_count, i, j, kind, depth, zf, flags;
+	union c_insn *pc;
+	struct c_ident *f;
+
+	insns = mem_alloc(sizeof(*insns) * size);
+	labels = mem_calloc(size + 1, sizeof(*labels));
+	target = mem_calloc(size + 1, 1);
+	fixups = mem_alloc(sizeof(*fixups) * size);
+	c_native_entries = mem_calloc(size + 1, sizeof(*c_native_entries));
+
+/* Decode the threaded code, splitting combined pushes */
+	count = 0;
+	pc = c_code_start;
+	while (pc < c_code_ptr) {
+		void (*op)(void) = pc->op;
+		int offset = pc - c_code_start, pushes = 0;
+		const char *kinds = NULL;
+
+		if (op == c_op_return)
+			kind = C_N_RETURN;
+		else if (op == c_op_bz)
+			kind = C_N_BZ;
+		else if (op == c_op_ba)
+			kind = C_N_BA;
+		else if (op == c_op_pop)
+			kind = C_N_POP;
+		else if (op == c_op_assign_pop)
+			kind = C_N_ASSIGN_POP;
+		else if (op == c_op_push_imm)
+			kinds = "i";
+		else if (op == c_op_push_mem)
+			kinds = "m";
+		else if (op == c_op_push_imm_imm)
+			kinds = "ii";
+		else if (op == c_op_push_imm_mem)
+			kinds = "im";
+		else if (op == c_op_push_mem_imm)
+			kinds = "mi";
+		else if (op == c_op_push_mem_mem)
+			kinds = "mm";
+		else if (op == c_op_push_mem_mem_mem)
+			kinds = "mmm";
+		else if (op == c_op_push_mem_mem_mem_imm)
+			kinds = "mmmi";
+		else if (op == c_op_push_mem_mem_mem_mem)
+			kinds = "mmmm";
+		else {
+			for (kind = 0; c_ops[kind].prec > 0; kind++)
+				if (c_ops[kind].op == op)
+					break;
+			if (c_ops[kind].prec <= 0)
+				goto out;
+		}
+
+		pc++;
+		if (kinds) {
+			while (kinds[pushes]) {
+				insn = &insns[count++];
+				insn->kind = kinds[pushes] == 'i' ?
+					C_N_PUSH_IMM : C_N_PUSH_MEM;
+				insn->offset = pushes ? -1 : offset;
+				insn->arg = *pc++;
+				pushes++;
+			}
+			continue;
+		}
+
+		insn = &insns[count++];
+		insn->kind = kind;
+		insn->offset = offset;
+		if (kind == C_N_BZ || kind == C_N_BA) {
+			insn->arg = *pc++;
+			j = insn->arg.pc - c_code_start;
+			if (j < 0 || j > size)
+				goto out;
+			target[j] = 1;
+		}
+	}
+
+	for (f = c_funcs; f; f = f->next)
+		target[(union c_insn *)f->addr - c_code_start] = 1;
+
+	c_native_size = (size_t)count * C_NATIVE_INSN_MAX +
+		(size_t)size * C_NATIVE_PROLOGUE + 1;
+	c_native_code = mmap(NULL, c_native_size, PROT_READ | PROT_WRITE,
+	    MAP_ANON | MAP_PRIVATE, -1, 0);
+	if (c_native_code == MAP_FAILED) {
+		c_native_code = NULL;
+		goto out;
+	}
+	c_n_ptr = c_native_code;
+	end = c_native_code + c_native_size;
+
+	depth = zf = fixup_count = 0;
+	for (i = 0; i < count; i++) {
+		insn = &insns[i];
+
+		if (insn->offset >= 0 && target[insn->offset]) {
+			if (depth)
+				goto out;
+			labels[insn->offset] = c_n_ptr;
+			zf = 0;
+		}
+		for (f = c_funcs; f; f = f->next)
+		if (insn->offset == (union c_insn *)f->addr - c_code_start) {
+/* movabs r10, &c_stack[2]; xor eax, eax */
+			c_native_entries[insn->offset] = c_n_ptr;
+			C_N(0x49, 0xba);
+			c_n_64(&c_stack[2]);
+			C_N(0x31, 0xc0);
+		}
+
+		if (c_n_ptr + C_NATIVE_INSN_MAX > end)
+			goto out;
+
+/* Following instructions we may combine with this one */
+#define NEXT(n) \
+	(i + (n) < count && (insns[i + (n)].offset < 0 || \
+	    !target[insns[i + (n)].offset]) ? insns[i + (n)].kind : -1)
+
+		kind = insn->kind;
+		next = &insns[i + 1];
+
+		if (kind == C_N_PUSH_MEM && !depth) {
+			const void *addr = insn->arg.mem;
+
+/* var = imm; */
+			if (NEXT(1) == C_N_PUSH_IMM && NEXT(2) == C_N_ASSIGN_POP) {
+				c_n_rcx(addr);
+				C_N(0xc7, 0x01);
+				c_n_32(next->arg.imm);
+				zf = 0;
+				i += 2;
+				continue;
+			}
+/* var = var; */
+			if (NEXT(1) == C_N_PUSH_MEM && NEXT(2) == C_N_ASSIGN_POP) {
+				c_n_rcx(next->arg.mem);
+				C_N(0x8b, 0x01);
+				c_n_rcx(addr);
+				C_N(0x89, 0x01);
+				zf = 0;
+				i += 2;
+				continue;
+			}
+/* var op= imm; */
+			if (NEXT(1) == C_N_PUSH_IMM && NEXT(3) == C_N_POP) {
+				unsigned char modrm = 0;
+
+				switch (NEXT(2)) {
+				case C_N_ADD_A: modrm = 0x01; break;
+				case C_N_OR_A: modrm = 0x09; break;
+				case C_N_AND_A: modrm = 0x21; break;
+				case C_N_SUB_A: modrm = 0x29; break;
+				case C_N_XOR_A: modrm = 0x31; break;
+				}
+				if (modrm) {
+					c_n_rcx(addr);
+					*c_n_ptr++ = 0x81;
+					*c_n_ptr++ = modrm;
+					c_n_32(next->arg.imm);
+					zf = 0;
+					i += 3;
+					continue;
+				}
+			}
+/* var++; var--; */
+			if (NEXT(2) == C_N_POP &&
+			    (NEXT(1) == C_N_INC_L || NEXT(1) == C_N_INC_R ||
+			    NEXT(1) == C_N_DEC_L || NEXT(1) == C_N_DEC_R)) {
+				c_n_rcx(addr);
+				if (NEXT(1) == C_N_INC_L || NEXT(1) == C_N_INC_R)
+					C_N(0x83, 0x01, 0x01);
+				else
+					C_N(0x83, 0x29, 0x01);
+				zf = 0;
+				i += 2;
+				continue;
+			}
+		}
+
+/* Push immediately consumed by a binary operator */
+		if (kind == C_N_PUSH_IMM || kind == C_N_PUSH_MEM) {
+			int op = NEXT(1), imm = kind == C_N_PUSH_IMM;
+			unsigned char opc = 0;
+
+			switch (op) {
+			case C_N_ADD: opc = 0x03; break;
+			case C_N_OR_L: case C_N_OR_I: opc = 0x0b; break;
+			case C_N_AND_I: opc = 0x23; break;
+			case C_N_NE: case C_N_SUB: opc = 0x2b; break;
+			case C_N_XOR_I: opc = 0x33; break;
+			case C_N_MUL: case C_N_SHL: case C_N_SHR:
+				opc = 1;
+				break;
+			default:
+				if (c_n_is_cmp(op))
+					opc = 0x3b;
+			}
+
+			if (opc) {
+				if (!imm)
+					c_n_rcx(insn->arg.mem);
+				zf = 0;
+				if (op == C_N_MUL) {
+					if (imm) {
+						C_N(0x69, 0xc0);
+						c_n_32(insn->arg.imm);
+					} else
+						C_N(0x0f, 0xaf, 0x01);
+				} else if (op == C_N_SHL || op == C_N_SHR) {
+					unsigned char modrm =
+					    op == C_N_SHL ? 0xe0 : 0xf8;
+					if (imm) {
+						*c_n_ptr++ = 0xc1;
+						*c_n_ptr++ = modrm;
+						*c_n_ptr++ = insn->arg.imm;
+					} else {
+						C_N(0x8b, 0x09);
+						*c_n_ptr++ = 0xd3;
+						*c_n_ptr++ = modrm;
+					}
+				} else if (imm) {
+/* op eax, imm32 has opcode op eax, r/m32 + 2 */
+					*c_n_ptr++ = opc + 2;
+					c_n_32(insn->arg.imm);
+					zf = opc != 0x3b;
+				} else {
+					*c_n_ptr++ = opc;
+					*c_n_ptr++ = 0x01;
+					zf = opc != 0x3b;
+				}
+
+				i++;
+				if (c_n_is_cmp(op)) {
+					if (NEXT(1) == C_N_BZ) {
+						i++;
+						if ((depth -= 2))
+							goto out;
+						*c_n_ptr++ = 0x0f;
+						*c_n_ptr++ = c_n_jcc_false(op);
+						fixups[fixup_count].at = c_n_ptr;
+						fixups[fixup_count++].target =
+						    insns[i].arg.pc - c_code_start;
+						c_n_ptr += 4;
+					} else {
+						*c_n_ptr++ = 0x0f;
+						*c_n_ptr++ = c_n_setcc(op);
+						C_N(0xc0, 0x0f, 0xb6, 0xc0);
+					}
+				}
+				continue;
+			}
+		}
+
+		flags = zf;
+		zf = 0;
+		switch (kind) {
+		case C_N_RETURN:
+			C_N(0xc3);
+			break;
+
+		case C_N_BZ:
+			if ((depth -= 2))
+				goto out;
+			if (!flags)
+				C_N(0x85, 0xc0);
+			/* Fall through */
+		case C_N_BA:
+			if (depth)
+				goto out;
+			if (kind == C_N_BZ)
+				C_N(0x0f, 0x84);
+			else
+				C_N(0xe9);
+			fixups[fixup_count].at = c_n_ptr;
+			fixups[fixup_count++].target =
+			    insn->arg.pc - c_code_start;
+			c_n_ptr += 4;
+			break;
+
+		case C_N_PUSH_IMM:
+		case C_N_PUSH_MEM:
+			if (depth) {
+				C_N(0x41, 0x89);
+				c_n_slot(0, depth - 2);
+			}
+			if (kind == C_N_PUSH_IMM) {
+				C_N(0xb8);
+				c_n_32(insn->arg.imm);
+			} else {
+				c_n_rcx(insn->arg.mem);
+				C_N(0x49, 0x89);
+				c_n_slot(1, depth + 1);
+				C_N(0x8b, 0x01);
+			}
+			depth += 2;
+			break;
+
+		case C_N_POP:
+			depth -= 2;
+			break;
+
+		case C_N_INDEX:
+			C_N(0x49, 0x8b);
+			c_n_slot(1, depth - 3);
+			C_N(0x48, 0x63, 0xd0, 0x48, 0x8d, 0x0c, 0x91);
+			C_N(0x49, 0x89);
+			c_n_slot(1, depth - 3);
+			C_N(0x8b, 0x01);
+			depth -= 2;
+			break;
+
+		case C_N_ASSIGN:
+		case C_N_ASSIGN_POP:
+			C_N(0x49, 0x8b);
+			c_n_slot(1, depth - 3);
+			C_N(0x89, 0x01);
+			depth -= kind == C_N_ASSIGN ? 2 : 4;
+			break;
+
+		case C_N_ADD_A:
+		case C_N_SUB_A:
+		case C_N_OR_A:
+		case C_N_XOR_A:
+		case C_N_AND_A:
+			C_N(0x49, 0x8b);
+			c_n_slot(1, depth - 3);
+			switch (kind) {
+			case C_N_ADD_A: C_N(0x01, 0x01); break;
+			case C_N_SUB_A: C_N(0x29, 0x01); break;
+			case C_N_OR_A: C_N(0x09, 0x01); break;
+			case C_N_XOR_A: C_N(0x31, 0x01); break;
+			default: C_N(0x21, 0x01);
+			}
+			C_N(0x8b, 0x01);
+			depth -= 2;
+			break;
+
+		case C_N_MUL_A:
+			C_N(0x49, 0x8b);
+			c_n_slot(1, depth - 3);
+			C_N(0x0f, 0xaf, 0x01, 0x89, 0x01);
+			depth -= 2;
+			break;
+
+		case C_N_DIV_A:
+		case C_N_MOD_A:
+			C_N(0x49, 0x8b);
+			c_n_slot(1, depth - 3);
+			C_N(0x41, 0x89, 0xc3, 0x8b, 0x01, 0x99, 0x41, 0xf7, 0xfb);
+			if (kind == C_N_DIV_A)
+				C_N(0x89, 0x01);
+			else
+				C_N(0x89, 0x11, 0x89, 0xd0);
+			depth -= 2;
+			break;
+
+		case C_N_SHL_A:
+		case C_N_SHR_A:
+			C_N(0x49, 0x8b);
+			c_n_slot(2, depth - 3);
+			if (kind == C_N_SHL_A)
+				C_N(0x89, 0xc1, 0xd3, 0x22, 0x8b, 0x02);
+			else
+				C_N(0x89, 0xc1, 0xd3, 0x3a, 0x8b, 0x02);
+			depth -= 2;
+			break;
+
+/* As in the interpreter, "||" is computed as "|" and "!=" as "-" */
+		case C_N_OR_L:
+		case C_N_OR_I:
+		case C_N_XOR_I:
+		case C_N_AND_I:
+		case C_N_ADD:
+		case C_N_NE:
+		case C_N_SUB:
+			if (kind == C_N_NE || kind == C_N_SUB)
+				C_N(0xf7, 0xd8);
+			switch (kind) {
+			case C_N_OR_L: case C_N_OR_I: C_N(0x41, 0x0b); break;
+			case C_N_XOR_I: C_N(0x41, 0x33); break;
+			case C_N_AND_I: C_N(0x41, 0x23); break;
+			default: C_N(0x41, 0x03);
+			}
+			c_n_slot(0, depth - 4);
+			zf = 1;
+			depth -= 2;
+			break;
+
+		case C_N_MUL:
+			C_N(0x41, 0x0f, 0xaf);
+			c_n_slot(0, depth - 4);
+			depth -= 2;
+			break;
+
+		case C_N_EQ:
+		case C_N_GT:
+		case C_N_LT:
+		case C_N_GE:
+		case C_N_LE:
+			C_N(0x41, 0x39);
+			c_n_slot(0, depth - 4);
+			depth -= 2;
+			if (NEXT(1) == C_N_BZ) {
+				i++;
+				if ((depth -= 2))
+					goto out;
+				*c_n_ptr++ = 0x0f;
+				*c_n_ptr++ = c_n_jcc_false(kind);
+				fixups[fixup_count].at = c_n_ptr;
+				fixups[fixup_count++].target =
+				    insns[i].arg.pc - c_code_start;
+				c_n_ptr += 4;
+			} else {
+				*c_n_ptr++ = 0x0f;
+				*c_n_ptr++ = c_n_setcc(kind);
+				C_N(0xc0, 0x0f, 0xb6, 0xc0);
+			}
+			break;
+
+		case C_N_AND_B:
+			C_N(0x41, 0x8b);
+			c_n_slot(1, depth - 4);
+			C_N(0x85, 0xc9, 0x0f, 0x95, 0xc1, 0x85, 0xc0, 0x0f, 0x95, 0xc0,
+			    0x20, 0xc8, 0x0f, 0xb6, 0xc0);
+			depth -= 2;
+			break;
+
+		case C_N_SHL:
+		case C_N_SHR:
+			C_N(0x89, 0xc1, 0x41, 0x8b);
+			c_n_slot(0, depth - 4);
+			if (kind == C_N_SHL)
+				C_N(0xd3, 0xe0);
+			else
+				C_N(0xd3, 0xf8);
+			depth -= 2;
+			break;
+
+		case C_N_DIV:
+		case C_N_MOD:
+			C_N(0x41, 0x89, 0xc3, 0x41, 0x8b);
+			c_n_slot(0, depth - 4);
+			C_N(0x99, 0x41, 0xf7, 0xfb);
+			if (kind == C_N_MOD)
+				C_N(0x89, 0xd0);
+			depth -= 2;
+			break;
+
+		case C_N_NOT_B:
+			C_N(0x85, 0xc0, 0x0f, 0x94, 0xc0, 0x0f, 0xb6, 0xc0);
+			break;
+
+		case C_N_NOT_I:
+			C_N(0xf7, 0xd0);
+			break;
+
+		case C_N_NEG:
+			C_N(0xf7, 0xd8);
+			zf = 1;
+			break;
+
+		case C_N_INC_L:
+		case C_N_DEC_L:
+			if (kind == C_N_INC_L)
+				C_N(0x83, 0xc0, 0x01);
+			else
+				C_N(0x83, 0xe8, 0x01);
+			C_N(0x49, 0x8b);
+			c_n_slot(1, depth - 1);
+			C_N(0x89, 0x01);
+			zf = 1;
+			break;
+
+		case C_N_INC_R:
+		case C_N_DEC_R:
+			if (kind == C_N_INC_R)
+				C_N(0x8d, 0x50, 0x01);
+			else
+				C_N(0x8d, 0x50, 0xff);
+			C_N(0x49, 0x8b);
+			c_n_slot(1, depth - 1);
+			C_N(0x89, 0x11);
+			break;
+
+		default:
+			goto out;
+		}
+#undef NEXT
+	}
+
+	for (i = 0; i < fixup_count; i++) {
+		c_int rel;
+
+		if (!labels[fixups[i].target])
+			goto out;
+		rel = labels[fixups[i].target] - (fixups[i].at + 4);
+		memcpy(fixups[i].at, &rel, 4);
+	}
+
+	if (mprotect(c_native_code, c_native_size, PROT_READ | PROT_EXEC))
+		goto out;
+
+	MEM_FREE(insns);
+	MEM_FREE(labels);
+	MEM_FREE(target);
+	MEM_FREE(fixups);
+	return;
+
+out:
+	c_native_free();
+	MEM_FREE(insns);
+	MEM_FREE(labels);
+	MEM_FREE(target);
+	MEM_FREE(fixups);
+}
+#endif
+
 int c_compile(int (*ext_getchar)(void), void (*ext_rewind)(void),
 	struct c_ident *externs)
 {
@@ -892,6 +1554,9 @@ int c_compile(int (*ext_getchar)(void), void (*ext_rewind)(void),
 	c_ext_getchar = ext_getchar;
 	c_ext_rewind = ext_rewind;
 
+#ifdef C_NATIVE
+	c_native_free();
+#endif
 	MEM_FREE(c_code_start);
 	MEM_FREE(c_data_start);
 	c_free_ident(c_funcs, NULL);
@@ -919,6 +1584,11 @@ int c_compile(int (*ext_getchar)(void), void (*ext_rewind)(void),
 		memset(c_data_start, 0, (size_t)c_data_ptr);
 	}
 
+#ifdef C_NATIVE
+	if (!c_errno && c_native)
+		c_native_compile();
+#endif
+
 	return c_errno;
 }
 
@@ -930,6 +1600,23 @@ void *c_lookup(const char *name)
 	return NULL;
 }
 
+#ifdef C_NATIVE
+static int c_native_execute(void *addr)
+{
+	union c_insn *pc = addr;
+	void (*entry)(void);
+
+	if (!c_native_entries || pc < c_code_start || pc >= c_code_ptr ||
+	    !c_native_entries[pc - c_code_start])
+		return 0;
+
+	entry = (void (*)(void))c_native_entries[pc - c_code_start];
+	entry();
+
+	return 1;
+}
+#endif
+
 #if !defined(__GNUC__) || defined(PRINT_INSNS)
 
 void c_execute_fast(void *addr)
@@ -938,6 +1625,11 @@ void c_execute_fast(void *addr)
 	static unsigned long long insns;
 #endif
 
+#ifdef C_NATIVE
+	if (c_native_execute(addr))
+		return;
+#endif
+
 /*
  * The top stack element may have been pre-filled by c_subexpr() and used by
  * the temporary code snippets it generates.
@@ -1066,6 +1758,11 @@ void c_execute_fast(void *addr)
 		return;
 	}
 
+#ifdef C_NATIVE
+	if (c_native_execute(addr))
+		return;
+#endif
+
 	goto *(pc++)->op;
 
 op_return:
@@ -65,6 +65,13 @@ struct c_ident {
 	void *addr;
 };
 
+/*
+ * If set, c_compile() also translates the program to native code where that
+ * is supported (currently x86-64), and c_execute_fast() then runs that.  The
+ * interpreter is used otherwise, and remains the reference implementation.
+ */
+extern int c_native;
+
 /*
  * Runs the compiler, and allocates some memory for its output and the
  * program's data. Returns one of the error codes.
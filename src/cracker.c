@@ -47,6 +47,8 @@
 #include "loader.h"
 #include "logger.h"
 #include "status.h"
+#include "metrics.h"
+#include "prof.h"
 #include "recovery.h"
 #include "external.h"
 #include "options.h"
@@ -93,6 +95,22 @@ static char crk_stdout_key[PLAINTEXT_BUFFER_SIZE];
 static int kpc_warn, kpc_warn_limit, single_running;
 static fix_state_fp hybrid_fix_state;
 
+/*
+ * Hashes cracked by the crypt_all() batch being scanned.  They're removed
+ * from the database in one go once the scan is over, rather than as they're
+ * found, which would leave the prefetched bitmap and hash table entries stale.
+ * Until then, the open addressing set tells a repeat crack (by a duplicate
+ * key) apart.
+ */
+static struct db_password **crk_cracked, **crk_cracked_set;
+static unsigned int crk_cracked_count, crk_cracked_size;
+
+/*
+ * Set while crk_salt_loop() goes through the salts, which are then left in
+ * the list when their last hash is cracked, and unlinked at the end.
+ */
+static int crk_defer_salts, crk_salts_emptied;
+
 int crk_stacked_rule_count = 1;
 rule_stack crk_rule_stack;
 
@@ -102,6 +120,7 @@ void (*crk_fix_state)(void);
 int (*crk_process_key)(char *key);
 
 static int process_key_stack_rules(char *key);
+static int crk_prof_process_key(char *key);
 
 /* Expose max_keys_per_crypt to the world (needed in recovery.c) */
 int crk_max_keys_per_crypt(void)
@@ -109,6 +128,11 @@ int crk_max_keys_per_crypt(void)
 	return options.force_maxkeys ? options.force_maxkeys : crk_params->max_keys_per_crypt;
 }
 
+int crk_keys_queued(void)
+{
+	return crk_key_index;
+}
+
 static void crk_dummy_set_salt(void *salt)
 {
 	/* Refresh salt every 30 seconds in case it was thrashed */
@@ -124,7 +148,7 @@ static void crk_dummy_fix_state(void)
 
 static void crk_init_salt(void)
 {
-	if (!crk_db->salts->next) {
+	if (crk_db->salts && !crk_db->salts->next) {
 		crk_methods.set_salt(crk_db->salts->salt);
 		crk_methods.set_salt = crk_dummy_set_salt;
 	}
@@ -140,6 +164,10 @@ static void crk_help(void)
 	if ((options.flags & FLG_STDOUT) && isatty(fileno(stdout)))
 		return;
 
+	/* Keys aren't read during --test-lookup */
+	if (options.flags & FLG_LOOKUP_CHK)
+		return;
+
 #ifdef HAVE_MPI
 	if (mpi_p > 1 || getenv("OMPI_COMM_WORLD_SIZE"))
 #ifdef SIGUSR1
@@ -229,6 +257,8 @@ void crk_init(struct db_main *db, void (*fix_state)(void),
 
 	kpc_warn = crk_params->min_keys_per_crypt;
 
+	prof_init(PROF_GEN);
+
 	if (db->loaded) {
 		size = crk_params->max_keys_per_crypt * sizeof(uint64_t);
 		memset(crk_timestamps = mem_alloc(size), -1, size);
@@ -258,6 +288,8 @@ void crk_init(struct db_main *db, void (*fix_state)(void),
 
 	if (rules_stacked_after)
 		crk_process_key = process_key_stack_rules;
+	else if (prof_enabled)
+		crk_process_key = crk_prof_process_key;
 	else
 		crk_process_key = crk_direct_process_key;
 
@@ -272,19 +304,15 @@ void crk_init(struct db_main *db, void (*fix_state)(void),
 }
 
 /*
- * crk_remove_salt() is called by crk_remove_hash() when it happens to remove
- * the last password hash for a salt.
+ * Unlinks the salt that current points to.
  */
-static void crk_remove_salt(struct db_salt *salt)
+static void crk_unlink_salt(struct db_salt **current)
 {
-	struct db_salt **current;
+	struct db_salt *salt = *current;
 
 	crk_db->salt_count--;
 	status.salt_count = crk_db->salt_count;
 
-	current = &crk_db->salts;
-	while (*current != salt)
-		current = &(*current)->next;
 	*current = salt->next;
 
 	/* If we kept the salt_hash table, update it */
@@ -307,6 +335,40 @@ static void crk_remove_salt(struct db_salt *salt)
 	dyna_salt_remove(salt->salt);
 }
 
+/*
+ * crk_remove_salt() is called by crk_remove_hash() when it happens to remove
+ * the last password hash for a salt.
+ */
+static void crk_remove_salt(struct db_salt *salt)
+{
+	struct db_salt **current;
+
+	current = &crk_db->salts;
+	while (*current != salt)
+		current = &(*current)->next;
+
+	crk_unlink_salt(current);
+}
+
+/*
+ * Unlinks the salts left empty while crk_defer_salts was set, in one pass.
+ */
+static void crk_remove_empty_salts(void)
+{
+	struct db_salt **current = &crk_db->salts;
+
+	crk_salts_emptied = 0;
+
+	while (*current) {
+		if ((*current)->count)
+			current = &(*current)->next;
+		else
+			crk_unlink_salt(current);
+	}
+
+	crk_init_salt();
+}
+
 /*
  * Updates the database after a password has been cracked.
  */
@@ -324,7 +386,10 @@ static void crk_remove_hash(struct db_salt *salt, struct db_password *pw)
 
 	if (!--salt->count) {
 		salt->list = NULL; /* "single crack" mode might care */
-		crk_remove_salt(salt);
+		if (crk_defer_salts)
+			crk_salts_emptied = 1;
+		else
+			crk_remove_salt(salt);
 		if (!salt->bitmap)
 			return;
 	}
@@ -386,8 +451,11 @@ static void crk_remove_hash(struct db_salt *salt, struct db_password *pw)
 		pw->binary = NULL;
 }
 
-/* Negative index is not counted/reported (got it from pot sync) */
-static int crk_process_guess(struct db_salt *salt, struct db_password *pw, int index)
+/*
+ * Logs and counts a guess, leaving the database alone.
+ * Negative index is not counted/reported (got it from pot sync).
+ */
+static void crk_report_guess(struct db_salt *salt, struct db_password *pw, int index)
 {
 	char utf8buf_key[PLAINTEXT_BUFFER_SIZE + 1];
 	char utf8login[PLAINTEXT_BUFFER_SIZE + 1];
@@ -486,6 +554,17 @@ static int crk_process_guess(struct db_salt *salt, struct db_password *pw, int i
 			crk_guesses->count++;
 		}
 	}
+}
+
+/* Negative index is not counted/reported (got it from pot sync) */
+static int crk_process_guess(struct db_salt *salt, struct db_password *pw, int index)
+{
+	unsigned int prof_prev = 0;
+
+	if (prof_enabled)
+		prof_prev = prof_switch(PROF_GUESS);
+
+	crk_report_guess(salt, pw, index);
 
 	if (!(crk_params->flags & FMT_NOT_EXACT))
 		crk_remove_hash(salt, pw);
@@ -506,7 +585,113 @@ static int crk_process_guess(struct db_salt *salt, struct db_password *pw, int i
 		} while ((s = s->next));
 	}
 
-	if (!crk_db->salts)
+	if (prof_enabled)
+		prof_switch(prof_prev);
+
+	if (!crk_db->password_count)
+		return 1;
+
+	crk_init_salt();
+
+	return 0;
+}
+
+/*
+ * Adds pw to crk_cracked unless it's there already.  Returns 1 if added.
+ */
+static int crk_add_cracked(struct db_password *pw)
+{
+	unsigned int mask, i;
+
+	if (crk_cracked_count == crk_cracked_size) {
+		unsigned int j;
+
+		crk_cracked_size = crk_cracked_size ? crk_cracked_size * 2 : 256;
+		crk_cracked = mem_realloc(crk_cracked,
+		                          crk_cracked_size * sizeof(*crk_cracked));
+		MEM_FREE(crk_cracked_set);
+		crk_cracked_set = mem_calloc(crk_cracked_size * 2,
+		                             sizeof(*crk_cracked_set));
+		mask = crk_cracked_size * 2 - 1;
+		for (j = 0; j < crk_cracked_count; j++) {
+			i = ((size_t)crk_cracked[j] >> 3) * 0x9e3779b1U & mask;
+			while (crk_cracked_set[i])
+				i = (i + 1) & mask;
+			crk_cracked_set[i] = crk_cracked[j];
+		}
+	}
+
+	mask = crk_cracked_size * 2 - 1;
+	i = ((size_t)pw >> 3) * 0x9e3779b1U & mask;
+	while (crk_cracked_set[i]) {
+		if (crk_cracked_set[i] == pw)
+			return 0;
+		i = (i + 1) & mask;
+	}
+	crk_cracked_set[i] = crk_cracked[crk_cracked_count++] = pw;
+
+	return 1;
+}
+
+/*
+ * crk_process_guess() for the lookup loops in crk_password_loop(), which
+ * defers the removal to crk_remove_cracked().
+ */
+static int crk_batch_guess(struct db_salt *salt, struct db_password *pw, int index)
+{
+	unsigned int prof_prev = 0;
+
+	if ((crk_params->flags & FMT_NOT_EXACT) || options.regen_lost_salts)
+		return crk_process_guess(salt, pw, index);
+
+	if (!crk_add_cracked(pw))
+		return 0;
+
+	if (prof_enabled)
+		prof_prev = prof_switch(PROF_GUESS);
+
+	crk_report_guess(salt, pw, index);
+
+	if (prof_enabled)
+		prof_switch(prof_prev);
+
+	return 0;
+}
+
+/*
+ * Removes what crk_batch_guess() collected.  Returns 1 if that was the last of
+ * the hashes.
+ */
+static int crk_remove_cracked(struct db_salt *salt)
+{
+	unsigned int prof_prev = 0, mask, i;
+
+	if (!crk_cracked_count)
+		return 0;
+
+	if (prof_enabled)
+		prof_prev = prof_switch(PROF_GUESS);
+
+	/*
+	 * Emptying the set in reverse order of insertion never breaks the probe
+	 * sequence of an entry yet to be found.
+	 */
+	mask = crk_cracked_size * 2 - 1;
+	while (crk_cracked_count) {
+		struct db_password *pw = crk_cracked[--crk_cracked_count];
+
+		i = ((size_t)pw >> 3) * 0x9e3779b1U & mask;
+		while (crk_cracked_set[i] != pw)
+			i = (i + 1) & mask;
+		crk_cracked_set[i] = NULL;
+
+		crk_remove_hash(salt, pw);
+	}
+
+	if (prof_enabled)
+		prof_switch(prof_prev);
+
+	if (!crk_db->password_count)
 		return 1;
 
 	crk_init_salt();
@@ -642,6 +827,9 @@ int crk_reload_pot(void)
 	if (crk_params->flags & FMT_NOT_EXACT)
 		return 0;
 
+	/* Our own writes in flight would race with crk_pot_pos */
+	log_wait();
+
 	if (!(pot_file = fopen(path_expand(options.activepot), "rb")))
 		pexit("fopen: %s", path_expand(options.activepot));
 
@@ -798,7 +986,7 @@ static int crk_process_event(void)
 
 	if (event_save) {
 		event_save = 0;
-		rec_save();
+		rec_save_async();
 	}
 
 	if (event_help)
@@ -807,6 +995,9 @@ static int crk_process_event(void)
 	if (event_status)
 		status_print(0);
 
+	if (event_metrics)
+		metrics_update();
+
 	if (event_ticksafety) {
 		event_ticksafety = 0;
 		status_ticks_overflow_safety();
@@ -830,6 +1021,26 @@ void crk_set_hybrid_fix_state_func_ptr(fix_state_fp fp)
 	hybrid_fix_state = fp;
 }
 
+/*
+ * cmp_exact() for the lookup loops below, charged to its own stage when
+ * profiling.
+ */
+static MAYBE_INLINE int crk_cmp_exact(struct db_password *pw, int index)
+{
+	int ret;
+
+	if (!prof_enabled)
+		return crk_methods.cmp_exact(crk_methods.source(pw->source,
+		                                                pw->binary), index);
+
+	prof_switch(PROF_CMP_EXACT);
+	ret = crk_methods.cmp_exact(crk_methods.source(pw->source, pw->binary),
+	                            index);
+	prof_switch(PROF_LOOKUP);
+
+	return ret;
+}
+
 /*
  * Called from crk_salt_loop for every salt or, when in Single mode, from
  * crk_process_salt with just a specific salt.
@@ -846,6 +1057,9 @@ static int crk_password_loop(struct db_salt *salt)
 	sig_timer_emu_tick();
 #endif
 
+	if (prof_enabled)
+		prof_switch(PROF_OTHER);
+
 	idle_yield();
 
 	if (event_pending && crk_process_event())
@@ -905,8 +1119,17 @@ static int crk_password_loop(struct db_salt *salt)
 	}
 
 	count = crk_key_index;
-	match = crk_methods.crypt_all(&count, salt);
+	if (prof_enabled)
+		prof_switch(PROF_CRYPT);
+	if (metrics_enabled) {
+		metrics_crypt_start();
+		match = crk_methods.crypt_all(&count, salt);
+		metrics_crypt_end(count, crk_params->max_keys_per_crypt);
+	} else
+		match = crk_methods.crypt_all(&count, salt);
 	crk_last_key = count;
+	if (prof_enabled)
+		prof_switch(PROF_LOOKUP);
 
 	status_update_crypts((uint64_t)salt->count * count, count);
 
@@ -919,8 +1142,8 @@ static int crk_password_loop(struct db_salt *salt)
 			if (crk_methods.cmp_all(pw->binary, match))
 			for (index = 0; index < match; index++)
 			if (crk_methods.cmp_one(pw->binary, index))
-			if (crk_methods.cmp_exact(crk_methods.source(pw->source, pw->binary), index)) {
-				if (crk_process_guess(salt, pw, index))
+			if (crk_cmp_exact(pw, index)) {
+				if (crk_batch_guess(salt, pw, index))
 					return 1;
 				else {
 					if (!(crk_params->flags & FMT_NOT_EXACT))
@@ -929,7 +1152,7 @@ static int crk_password_loop(struct db_salt *salt)
 			}
 		} while ((pw = pw->next));
 
-		return 0;
+		return crk_remove_cracked(salt);
 	}
 
 #if CRK_PREFETCH
@@ -991,27 +1214,14 @@ static int crk_password_loop(struct db_salt *salt)
 			struct db_password *pw = *a[slot].u.p;
 			index = a[slot].i;
 			do {
+/*
+ * Cracked hashes stay in the hash table until crk_remove_cracked(), so what
+ * we've prefetched doesn't go stale.
+ */
 				if (crk_methods.cmp_one(pw->binary, index))
-				if (crk_methods.cmp_exact(crk_methods.source(
-				    pw->source, pw->binary), index)) {
-					if (crk_process_guess(salt, pw, index))
-						return 1;
-/* After we've successfully cracked and removed a hash, our prefetched bitmap
- * and hash table entries might be stale: some might correspond to the same
- * hash bucket, yet with this removed hash still in there if it was the first
- * one in the bucket.  If so, re-prefetch from the next lucky index if any,
- * yet complete handling of this index first. */
-					if (slot + 1 < lucky) {
-						struct db_password *first =
-						    salt->hash[
-						    salt->index(index) >>
-						    PASSWORD_HASH_SHR];
-						if (pw == first || !first) {
-							target = a[slot + 1].i;
-							lucky = 0;
-						}
-					}
-				}
+				if (crk_cmp_exact(pw, index))
+				if (crk_batch_guess(salt, pw, index))
+					return 1;
 			} while ((pw = pw->next_hash));
 		}
 	}
@@ -1024,16 +1234,15 @@ static int crk_password_loop(struct db_salt *salt)
 			    salt->hash[hash >> PASSWORD_HASH_SHR];
 			do {
 				if (crk_methods.cmp_one(pw->binary, index))
-				if (crk_methods.cmp_exact(crk_methods.source(
-				    pw->source, pw->binary), index))
-				if (crk_process_guess(salt, pw, index))
+				if (crk_cmp_exact(pw, index))
+				if (crk_batch_guess(salt, pw, index))
 					return 1;
 			} while ((pw = pw->next_hash));
 		}
 	}
 #endif
 
-	return 0;
+	return crk_remove_cracked(salt);
 }
 
 /*
@@ -1072,13 +1281,23 @@ static int crk_salt_loop(void)
 	}
 
 	/* Normal loop over all salts */
+	crk_defer_salts = !options.regen_lost_salts;
 	do {
+		if (prof_enabled)
+			prof_switch(PROF_CRYPT);
 		crk_methods.set_salt(salt->salt);
 		status.resume_salt_md5 = (crk_db->salt_count > 1) ?
 			salt->salt_md5 : NULL;
 		if ((done = crk_password_loop(salt)))
 			break;
 	} while ((salt = salt->next));
+	crk_defer_salts = 0;
+
+	if (prof_enabled)
+		prof_switch(PROF_OTHER);
+
+	if (crk_salts_emptied)
+		crk_remove_empty_salts();
 
 	if (event_delayed_status || (crk_db->salt_count < sc && john_main_process &&
 	                             cfg_get_bool(SECTION_OPTIONS, NULL, "ShowSaltProgress", 0))) {
@@ -1229,20 +1448,43 @@ int crk_direct_process_key(char *key)
 	return ext_abort;
 }
 
+/*
+ * Used instead of crk_direct_process_key() when profiling.
+ */
+static int crk_prof_process_key(char *key)
+{
+	unsigned int prev = prof_stage;
+	int ret;
+
+	if (!prof_sample(PROF_SET_KEY)) {
+		ret = crk_direct_process_key(key);
+		/* Back from running a batch? */
+		if (prof_stage != prev)
+			prof_switch(prev);
+		return ret;
+	}
+
+	prof_switch(PROF_SET_KEY);
+	ret = crk_direct_process_key(key);
+	prof_switch(prev);
+
+	return ret;
+}
+
 static int process_key_stack_rules(char *key)
 {
 	int ret = 0;
 	char *word;
 
 	while ((word = rules_process_stack_all(key, &crk_rule_stack)))
-		if ((ret = crk_direct_process_key(word)))
+		if ((ret = prof_enabled ? crk_prof_process_key(word) :
+		     crk_direct_process_key(word)))
 			break;
 
 	return ret;
 }
 
-/* This function is used by single.c only */
-int crk_process_salt(struct db_salt *salt)
+static int crk_salt_keys(struct db_salt *salt)
 {
 	char *ptr;
 	char key[PLAINTEXT_BUFFER_SIZE];
@@ -1275,7 +1517,10 @@ int crk_process_salt(struct db_salt *salt)
 		    (options.force_maxkeys && index >= options.force_maxkeys)) {
 			int done;
 			crk_key_index = index;
-			if ((done = crk_password_loop(salt)) >= 0) {
+			done = crk_password_loop(salt);
+			if (prof_enabled)
+				prof_switch(PROF_SET_KEY);
+			if (done >= 0) {
 /*
  * The approach we use here results in status.cands growing slower than it
  * ideally should until this loop completes (at which point status.cands has
@@ -1307,6 +1552,22 @@ int crk_process_salt(struct db_salt *salt)
 	return 0;
 }
 
+/* This function is used by single.c only */
+int crk_process_salt(struct db_salt *salt)
+{
+	unsigned int prev;
+	int ret;
+
+	if (!prof_enabled)
+		return crk_salt_keys(salt);
+
+	prev = prof_switch(PROF_SET_KEY);
+	ret = crk_salt_keys(salt);
+	prof_switch(prev);
+
+	return ret;
+}
+
 char *crk_get_key1(void)
 {
 	if (options.secure)
@@ -1339,6 +1600,16 @@ void crk_done(void)
 			crk_salt_loop();
 
 		MEM_FREE(crk_timestamps);
+		MEM_FREE(crk_cracked);
+		MEM_FREE(crk_cracked_set);
+		crk_cracked_size = 0;
+	}
+
+	if (prof_enabled) {
+		char s_prof[256];
+
+		log_event("- Profile: %s", prof_report(s_prof, sizeof(s_prof),
+		    status.cands - prof_cands, "p"));
 	}
 	c_cleanup();
 }
@@ -94,4 +94,7 @@ extern void crk_set_hybrid_fix_state_func_ptr(fix_state_fp fp);
 /* Show Remaining hashes & salts counts */
 extern char *crk_loaded_counts(void);
 
+/* Number of candidates buffered for the next crypt_all() */
+extern int crk_keys_queued(void);
+
 #endif
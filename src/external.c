@@ -21,6 +21,7 @@
 #include "loader.h"
 #include "logger.h"
 #include "status.h"
+#include "prof.h"
 #include "recovery.h"
 #include "options.h"
 #include "config.h"
@@ -224,6 +225,7 @@ void ext_init(char *mode, struct db_main *db)
 		error();
 	}
 
+	c_native = cfg_get_bool(SECTION_OPTIONS, NULL, "ExternalJIT", 1);
 	if (c_compile(ext_getchar, ext_rewind, &ext_globals)) {
 		if (!ext_line) ext_line = ext_source->tail;
 
@@ -324,12 +326,18 @@ int ext_filter_body(char *in, char *out)
 		} while (1);
 	}
 
-	c_execute_fast(f_filter);
+	if (prof_enabled && prof_sample(PROF_FILTER)) {
+		unsigned int prev = prof_switch(PROF_FILTER);
+
+		c_execute_fast(f_filter);
+		prof_switch(prev);
+	} else
+		c_execute_fast(f_filter);
 
 	if (!ext_word[0] && in[0]) return 0;
 
 	if (ext_utf32) {
-		utf32_to_enc((UTF8*)int_word, maxlen, (UTF32*)ext_word);
+		utf32_to_enc((UTF8*)out, maxlen, (UTF32*)ext_word);
 	} else {
 		internal = (unsigned char *)out;
 		external = ext_word;
@@ -0,0 +1,269 @@
+john_register_one(&fmt_ab);
+john_register_one(&fmt_adxcrypt);
+john_register_one(&fmt_agile_keychain);
+john_register_one(&fmt_aixssha1);
+john_register_one(&fmt_aixssha256);
+john_register_one(&fmt_aixssha512);
+john_register_one(&fmt_andotp);
+john_register_one(&fmt_ansible);
+john_register_one(&fmt_argon2);
+john_register_one(&fmt_armory);
+john_register_one(&fmt_as400des);
+john_register_one(&fmt_AS400_ssha1);
+john_register_one(&fmt_asaMD5);
+john_register_one(&fmt_axcrypt);
+john_register_one(&fmt_AzureAD);
+john_register_one(&fmt_bestcrypt);
+john_register_one(&fmt_bestcrypt_ve);
+john_register_one(&fmt_BFEgg);
+john_register_one(&fmt_bitcoin);
+john_register_one(&fmt_bitlocker);
+john_register_one(&fmt_bitshares);
+john_register_one(&fmt_bitwarden);
+john_register_one(&fmt_bks);
+john_register_one(&fmt_blackberry1);
+john_register_one(&fmt_blizzard);
+john_register_one(&fmt_blockchain);
+john_register_one(&fmt_cardano);
+john_register_one(&fmt_chap);
+john_register_one(&fmt_clipperz);
+john_register_one(&fmt_cloud_keychain);
+john_register_one(&fmt_CompiledDynamic);
+john_register_one(&fmt_cq);
+john_register_one(&fmt_crc32);
+john_register_one(&fmt_cryptosafe);
+john_register_one(&fmt_cryptsha1);
+john_register_one(&fmt_cryptsha256);
+john_register_one(&fmt_cryptsha512);
+john_register_one(&fmt_ctrxns);
+john_register_one(&fmt_dahua);
+john_register_one(&fmt_dashlane);
+john_register_one(&fmt_diskcryptor);
+john_register_one(&fmt_django);
+john_register_one(&fmt_django_scrypt);
+john_register_one(&fmt_DMD5);
+john_register_one(&fmt_dmg);
+john_register_one(&fmt_DOMINOSEC);
+john_register_one(&fmt_DOMINOSEC8);
+john_register_one(&fmt_DPAPImk);
+john_register_one(&fmt_dragonfly3_32);
+john_register_one(&fmt_dragonfly3_64);
+john_register_one(&fmt_dragonfly4_32);
+john_register_one(&fmt_dragonfly4_64);
+john_register_one(&fmt_drupal7);
+john_register_one(&fmt_ecryptfs1);
+john_register_one(&fmt_eigrp);
+john_register_one(&fmt_electrum);
+john_register_one(&fmt_encdadatavault_md5);
+john_register_one(&fmt_encdadatavault_pbkdf2);
+john_register_one(&fmt_encfs);
+john_register_one(&fmt_enpass);
+john_register_one(&fmt_EPI);
+john_register_one(&fmt_episerver);
+john_register_one(&fmt_ethereum);
+john_register_one(&fmt_fde);
+john_register_one(&fmt_FG2);
+john_register_one(&fmt_FGT);
+john_register_one(&fmt_FORMSPRING);
+john_register_one(&fmt_fvde);
+john_register_one(&fmt_geli);
+john_register_one(&fmt_gost);
+john_register_one(&fmt_gost12256hash);
+john_register_one(&fmt_gost12512hash);
+john_register_one(&fmt_gost94hash);
+john_register_one(&fmt_gpg);
+john_register_one(&fmt_haval_128_4);
+john_register_one(&fmt_haval_256_3);
+john_register_one(&fmt_HDAA);
+john_register_one(&fmt_hmailserver);
+john_register_one(&fmt_hsrp);
+john_register_one(&fmt_ike);
+john_register_one(&fmt_IPB2);
+john_register_one(&fmt_itunes);
+john_register_one(&fmt_iwork);
+john_register_one(&fmt_KeePass);
+john_register_one(&fmt_keplr);
+john_register_one(&fmt_keychain);
+john_register_one(&fmt_keyring);
+john_register_one(&fmt_keystore);
+john_register_one(&fmt_known_hosts);
+john_register_one(&fmt_KRB4);
+john_register_one(&fmt_KRB5);
+john_register_one(&fmt_krb5asrep);
+john_register_one(&fmt_krb5pa);
+john_register_one(&fmt_krb5pa_md5);
+john_register_one(&fmt_krb5tgs);
+john_register_one(&fmt_krb5tgs_aes);
+john_register_one(&fmt_krb5_17);
+john_register_one(&fmt_krb5_18);
+john_register_one(&fmt_krb5_3);
+john_register_one(&fmt_kwallet);
+john_register_one(&fmt_lastpass);
+john_register_one(&fmt_lastpass_cli);
+john_register_one(&fmt_leet);
+john_register_one(&fmt_lotus5);
+john_register_one(&fmt_lotus_85);
+john_register_one(&fmt_luks);
+john_register_one(&fmt_md2_);
+john_register_one(&fmt_mdc2);
+john_register_one(&fmt_mediawiki);
+john_register_one(&fmt_monero);
+john_register_one(&fmt_money);
+john_register_one(&fmt_mongodb);
+john_register_one(&fmt_mongodb_scram);
+john_register_one(&fmt_mozilla);
+john_register_one(&fmt_mscash);
+john_register_one(&fmt_mscash2);
+john_register_one(&fmt_MSCHAPv2_new);
+john_register_one(&fmt_MSCHAPv2_old);
+john_register_one(&fmt_mssql);
+john_register_one(&fmt_mssql05);
+john_register_one(&fmt_mssql12);
+john_register_one(&fmt_multibit);
+john_register_one(&fmt_mysqlna);
+john_register_one(&fmt_mysqlSHA1);
+john_register_one(&fmt_MYSQL_fast);
+john_register_one(&fmt_netah);
+john_register_one(&fmt_NETHALFLM);
+john_register_one(&fmt_NETLM);
+john_register_one(&fmt_NETLMv2);
+john_register_one(&fmt_netmd5);
+john_register_one(&fmt_NETNTLMv2);
+john_register_one(&fmt_NETNTLM_new);
+john_register_one(&fmt_NETNTLM_old);
+john_register_one(&fmt_netsha1);
+john_register_one(&fmt_nk);
+john_register_one(&fmt_notes);
+john_register_one(&fmt_NS);
+john_register_one(&fmt_nsec3);
+john_register_one(&fmt_NT2);
+john_register_one(&fmt_NT_long);
+john_register_one(&fmt_o10glogon);
+john_register_one(&fmt_o3logon);
+john_register_one(&fmt_o5logon);
+john_register_one(&fmt_odf);
+john_register_one(&fmt_office);
+john_register_one(&fmt_oldoffice);
+john_register_one(&fmt_openbsd_softraid);
+john_register_one(&fmt_openssl);
+john_register_one(&fmt_oracle);
+john_register_one(&fmt_oracle11);
+john_register_one(&fmt_oracle12c);
+john_register_one(&fmt_OSC);
+john_register_one(&fmt_ospf);
+john_register_one(&fmt_padlock);
+john_register_one(&fmt_palshop);
+john_register_one(&fmt_panama_);
+john_register_one(&fmt_pbkdf2_hmac_md4);
+john_register_one(&fmt_pbkdf2_hmac_md5);
+john_register_one(&fmt_pbkdf2_hmac_sha1);
+john_register_one(&fmt_pbkdf2_hmac_sha256);
+john_register_one(&fmt_pbkdf2_hmac_sha512);
+john_register_one(&fmt_pdf);
+john_register_one(&fmt_pem);
+john_register_one(&fmt_pfx);
+john_register_one(&fmt_pgpdisk);
+john_register_one(&fmt_pgpsda);
+john_register_one(&fmt_pgpwde);
+john_register_one(&fmt_phpassmd5);
+john_register_one(&fmt_PHPS);
+john_register_one(&fmt_PHPS2);
+john_register_one(&fmt_pixMD5);
+john_register_one(&fmt_pkzip);
+john_register_one(&fmt_PO);
+john_register_one(&fmt_postgres);
+john_register_one(&fmt_pst);
+john_register_one(&fmt_putty);
+john_register_one(&fmt_pwsafe);
+john_register_one(&fmt_qnx);
+john_register_one(&fmt_racf);
+john_register_one(&fmt_racf_kdfaes);
+john_register_one(&fmt_radius);
+john_register_one(&fmt_radmin);
+john_register_one(&fmt_rakp);
+john_register_one(&fmt_rar);
+john_register_one(&fmt_rar5);
+john_register_one(&fmt_raw0_SHA512);
+john_register_one(&fmt_rawBLAKE2);
+john_register_one(&fmt_rawKeccak);
+john_register_one(&fmt_rawKeccak_256);
+john_register_one(&fmt_rawMD4);
+john_register_one(&fmt_rawMD5);
+john_register_one(&fmt_rawmd5uthick);
+john_register_one(&fmt_rawSHA1);
+john_register_one(&fmt_rawSHA1_axcrypt);
+john_register_one(&fmt_rawSHA1_LI);
+john_register_one(&fmt_rawSHA224);
+john_register_one(&fmt_rawSHA256);
+john_register_one(&fmt_rawSHA3);
+john_register_one(&fmt_rawSHA384);
+john_register_one(&fmt_restic);
+john_register_one(&fmt_ripemd_128);
+john_register_one(&fmt_ripemd_160);
+john_register_one(&fmt_rsvp);
+john_register_one(&fmt_rvary);
+john_register_one(&fmt_s7);
+john_register_one(&fmt_saltedsha);
+john_register_one(&fmt_saltedsha2);
+john_register_one(&fmt_sapB);
+john_register_one(&fmt_sapG);
+john_register_one(&fmt_sapH);
+john_register_one(&fmt_sappse);
+john_register_one(&fmt_securezip);
+john_register_one(&fmt_sevenzip);
+john_register_one(&fmt_signal);
+john_register_one(&fmt_sip);
+john_register_one(&fmt_skein_256);
+john_register_one(&fmt_skein_512);
+john_register_one(&fmt_SKEY);
+john_register_one(&fmt_sl3);
+john_register_one(&fmt_sm3);
+john_register_one(&fmt_snefru_128);
+john_register_one(&fmt_snefru_256);
+john_register_one(&fmt_sniffed_lastpass);
+john_register_one(&fmt_snmp);
+john_register_one(&fmt_solarwinds);
+john_register_one(&fmt_ssh);
+john_register_one(&fmt_sspr);
+john_register_one(&fmt_stribog_256);
+john_register_one(&fmt_stribog_512);
+john_register_one(&fmt_strip);
+john_register_one(&fmt_sunmd5);
+john_register_one(&fmt_SybaseASE);
+john_register_one(&fmt_sybaseprop);
+john_register_one(&fmt_tacacsplus);
+john_register_one(&fmt_tcpmd5);
+john_register_one(&fmt_telegram);
+john_register_one(&fmt_tezos);
+john_register_one(&fmt_tiger);
+john_register_one(&fmt_timeroast);
+john_register_one(&fmt_truecrypt);
+john_register_one(&fmt_truecrypt_ripemd160);
+john_register_one(&fmt_truecrypt_ripemd160boot);
+john_register_one(&fmt_truecrypt_sha512);
+john_register_one(&fmt_truecrypt_whirlpool);
+john_register_one(&fmt_vdi);
+john_register_one(&fmt_VMS);
+john_register_one(&fmt_vmx);
+john_register_one(&fmt_vnc);
+john_register_one(&fmt_vtp);
+john_register_one(&fmt_wbb3);
+john_register_one(&fmt_whirlpool);
+john_register_one(&fmt_whirlpool_0);
+john_register_one(&fmt_whirlpool_1);
+john_register_one(&fmt_wpapsk);
+john_register_one(&fmt_wpapsk_pmk);
+john_register_one(&fmt_xmpp_scram);
+john_register_one(&fmt_XSHA);
+john_register_one(&fmt_XSHA512);
+john_register_one(&fmt_zed);
+john_register_one(&fmt_zip);
+john_register_one(&fmt_zipmonster);
+john_register_one(&fmt_zzz_plaintext);
+john_register_one(&fmt__HAS160);
+john_register_one(&fmt__hmacMD5);
+john_register_one(&fmt__hmacSHA1);
+john_register_one(&fmt__hmacSHA224);
+john_register_one(&fmt__hmacSHA256);
+john_register_one(&fmt__hmacSHA384);
+john_register_one(&fmt__hmacSHA512);
@@ -0,0 +1,327 @@
+/*
+ * This file is part of John the Ripper password cracker.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted.
+ *
+ * There's ABSOLUTELY NO WARRANTY, express or implied.
+ */
+
+#define NEED_OS_FORK
+#include "os.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <errno.h>
+#if (!AC_BUILT || HAVE_UNISTD_H) && !_MSC_VER
+#include <unistd.h>
+#endif
+#if OS_FORK
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+#include "arch.h"
+#include "misc.h"
+#include "params.h"
+#include "path.h"
+#include "memory.h"
+#include "options.h"
+#include "config.h"
+#include "recovery.h"
+#include "genbench.h"
+
+int genbench_time = GENBENCH_TIME;
+
+#if OS_FORK
+
+/* Fixed options ahead of the generator's, plus --node, --config and NULL */
+#define GENBENCH_FIXED_ARGS		7
+#define GENBENCH_EXTRA_ARGS		3
+
+struct genbench_child {
+	pid_t pid;
+	char *session, *metrics, *errors;
+};
+
+static int genbench_cpus(void)
+{
+	long n = 1;
+
+#ifdef _SC_NPROCESSORS_ONLN
+	if ((n = sysconf(_SC_NPROCESSORS_ONLN)) < 1)
+		n = 1;
+#endif
+	if (n > 1024)
+		n = 1024;
+
+	return n;
+}
+
+static char *genbench_name(int k, const char *suffix)
+{
+	char name[64];
+
+	snprintf(name, sizeof(name), "genbench-%u-%d", (unsigned int)getpid(), k);
+
+	return path_session(name, suffix);
+}
+
+static char *genbench_arg(const char *option, const char *value)
+{
+	size_t size = strlen(option) + strlen(value) + 1;
+	char *arg = mem_alloc_tiny(size, MEM_ALIGN_NONE);
+
+	snprintf(arg, size, "%s%s", option, value);
+
+	return arg;
+}
+
+static void genbench_start(struct genbench_child *child, char **args,
+	int nargs, int k, int total)
+{
+	char **argv;
+	char time_arg[32], node_arg[32];
+	int fd, argc = 0;
+
+	child->session = genbench_name(k, "");
+	child->metrics = genbench_name(k, ".metrics");
+	child->errors = genbench_name(k, ".err");
+	unlink(child->metrics);
+
+	argv = mem_alloc(sizeof(*argv) *
+		(GENBENCH_FIXED_ARGS + GENBENCH_EXTRA_ARGS + nargs));
+	argv[argc++] = rec_argv[0];
+	argv[argc++] = "--stdout";
+	argv[argc++] = "--verbosity=1";
+	argv[argc++] = "--no-log";
+	snprintf(time_arg, sizeof(time_arg), "--max-run-time=%d", genbench_time);
+	argv[argc++] = time_arg;
+	argv[argc++] = genbench_arg("--session=", child->session);
+	argv[argc++] = genbench_arg("--metrics=", child->metrics);
+	if (total > 1) {
+		snprintf(node_arg, sizeof(node_arg), "--node=%d/%d", k + 1, total);
+		argv[argc++] = node_arg;
+	}
+	if (options.config)
+		argv[argc++] = genbench_arg("--config=", options.config);
+	memcpy(&argv[argc], args, nargs * sizeof(*argv));
+	argv[argc + nargs] = NULL;
+
+	fflush(stdout);
+	fflush(stderr);
+
+	switch ((child->pid = fork())) {
+	case -1:
+		pexit("fork");
+
+	case 0:
+		/* One thread each, so process count is the thread count */
+		setenv("OMP_NUM_THREADS", "1", 1);
+		if ((fd = open("/dev/null", O_WRONLY)) >= 0) {
+			dup2(fd, 1);
+			close(fd);
+		}
+		if ((fd = open(child->errors, O_WRONLY | O_CREAT | O_TRUNC,
+		               0600)) >= 0) {
+			dup2(fd, 2);
+			close(fd);
+		}
+		execvp(argv[0], argv);
+		perror("execvp");
+		_exit(1);
+	}
+
+	MEM_FREE(argv);
+}
+
+/*
+ * Gets the candidate count and run time from the child's final metrics
+ * record.  Returns non-zero if there's none.
+ */
+static int genbench_result(struct genbench_child *child,
+	unsigned long long *cands, double *elapsed)
+{
+	FILE *file;
+	char line[LINE_BUFFER_SIZE], *p;
+	int found = 0;
+
+	if (!(file = fopen(child->metrics, "r")))
+		return -1;
+
+	while (fgets(line, sizeof(line), file)) {
+		if (!strstr(line, "\"final\":true") ||
+		    !(p = strstr(line, "],\"elapsed\":")) ||
+		    sscanf(p, "],\"elapsed\":%lf", elapsed) != 1 ||
+		    !(p = strstr(p, ",\"cands\":")) ||
+		    sscanf(p, ",\"cands\":%llu", cands) != 1)
+			continue;
+		found = 1;
+	}
+
+	fclose(file);
+
+	return !found;
+}
+
+/*
+ * Last line the child printed to stderr, to tell why it failed.
+ */
+static char *genbench_error(struct genbench_child *child, char *buffer,
+	size_t size)
+{
+	FILE *file;
+	char line[LINE_BUFFER_SIZE];
+
+	strnzcpy(buffer, "no metrics written", size);
+
+	if (!(file = fopen(child->errors, "r")))
+		return buffer;
+
+	while (fgets(line, sizeof(line), file)) {
+		strtok(line, "\r\n");
+		if (*line && *line != '\n')
+			strnzcpy(buffer, line, size);
+	}
+
+	fclose(file);
+
+	return buffer;
+}
+
+static void genbench_cleanup(struct genbench_child *child)
+{
+	unlink(path_session(child->session, RECOVERY_SUFFIX));
+	unlink(child->metrics);
+	unlink(child->errors);
+}
+
+static char *genbench_rate(char *buffer, double rate)
+{
+	if (rate >= 1e12)
+		sprintf(buffer, "%uG", (unsigned int)(rate / 1e9));
+	else if (rate >= 1e9)
+		sprintf(buffer, "%uM", (unsigned int)(rate / 1e6));
+	else if (rate >= 1e6)
+		sprintf(buffer, "%uK", (unsigned int)(rate / 1e3));
+	else
+		sprintf(buffer, "%u", (unsigned int)rate);
+
+	return buffer;
+}
+
+/*
+ * Runs one generator with total processes and prints their combined rate.
+ * Returns non-zero on failure.
+ */
+static int genbench_one(char **args, int nargs, int total)
+{
+	struct genbench_child *children;
+	double rate = 0;
+	char error[LINE_BUFFER_SIZE], total_rate[32], each_rate[32];
+	int k, failed = -1;
+
+	children = mem_calloc(total, sizeof(*children));
+
+	for (k = 0; k < total; k++)
+		genbench_start(&children[k], args, nargs, k, total);
+
+	for (k = 0; k < total; k++) {
+		unsigned long long cands;
+		double elapsed;
+		int status;
+
+		while (waitpid(children[k].pid, &status, 0) < 0 &&
+		       errno == EINTR)
+			;
+
+		if (genbench_result(&children[k], &cands, &elapsed)) {
+			if (failed < 0)
+				failed = k;
+			continue;
+		}
+		if (elapsed > 0)
+			rate += cands / elapsed;
+	}
+
+	printf("%d process%s:%s", total, total > 1 ? "es" : "",
+	       total > 9 ? "\t" : "\t\t");
+	if (failed >= 0)
+		printf("FAILED (%s)\n", genbench_error(&children[failed], error,
+		                                       sizeof(error)));
+	else if (total > 1)
+		printf("%s p/s (%s p/s each)\n",
+		       genbench_rate(total_rate, rate),
+		       genbench_rate(each_rate, rate / total));
+	else
+		printf("%s p/s\n", genbench_rate(total_rate, rate));
+
+	for (k = 0; k < total; k++)
+		genbench_cleanup(&children[k]);
+	MEM_FREE(children);
+
+	return failed >= 0;
+}
+
+int genbench_run(void)
+{
+	struct cfg_list *list;
+	struct cfg_line *line;
+	char **args;
+	int cpus = genbench_cpus(), failed = 0;
+
+	if (!(list = cfg_get_list(SECTION_GENBENCH, SUBSECTION_BENCHMARK)) ||
+	    !list->head)
+		error_msg("No generators in [" SECTION_GENBENCH
+		          SUBSECTION_BENCHMARK "]\n");
+
+	if (genbench_time < 1)
+		genbench_time = 1;
+
+	printf("Benchmarking candidate generators for %d second%s each, "
+	       "on up to %d process%s\n",
+	       genbench_time, genbench_time > 1 ? "s" : "",
+	       cpus, cpus > 1 ? "es" : "");
+
+	for (line = list->head; line; line = line->next) {
+		char *data = str_alloc_copy(line->data), *arg;
+		int nargs = 0, total;
+
+		args = mem_alloc(sizeof(*args) * (strlen(data) / 2 + 1));
+		for (arg = strtok(data, " \t"); arg; arg = strtok(NULL, " \t"))
+			args[nargs++] = arg;
+		if (!nargs) {
+			MEM_FREE(args);
+			continue;
+		}
+
+		printf("\n%s\n", line->data);
+
+		/* 1, 2, 4, ... and the CPU count, unless it won't run at all */
+		for (total = 1;; total <<= 1) {
+			if (total > cpus)
+				total = cpus;
+			if (genbench_one(args, nargs, total)) {
+				failed = 1;
+				break;
+			}
+			if (total >= cpus)
+				break;
+		}
+
+		MEM_FREE(args);
+	}
+
+	return failed;
+}
+
+#else
+
+int genbench_run(void)
+{
+	error_msg("--test-gen is not supported on this system\n");
+}
+
+#endif
@@ -0,0 +1,33 @@
+/*
+ * This file is part of John the Ripper password cracker.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted.
+ *
+ * There's ABSOLUTELY NO WARRANTY, express or implied.
+ */
+
+/*
+ * Candidate generator benchmark (--test-gen).
+ *
+ * Each line of the [List.Generators:Benchmark] section holds the cracking
+ * mode options for one generator.  For every line and process count, we run
+ * that many copies of ourselves with --stdout --verbosity=1 (which counts
+ * candidates without printing them) split with --node, and add up the rates
+ * from their final --metrics records.  No hash format is involved.
+ */
+
+#ifndef _JOHN_GENBENCH_H
+#define _JOHN_GENBENCH_H
+
+/*
+ * Seconds to run each generator for.
+ */
+extern int genbench_time;
+
+/*
+ * Runs the benchmark, returning non-zero if any generator failed.
+ */
+extern int genbench_run(void);
+
+#endif
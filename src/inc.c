@@ -6,8 +6,12 @@
  */
 
 #include <stdio.h>
+#include <stdint.h>
 #include <string.h>
 #include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "arch.h"
 #include "misc.h"
@@ -24,6 +28,7 @@
 #include "options.h"
 #include "config.h"
 #include "charset.h"
+#include "inc.h"
 #include "external.h"
 #include "cracker.h"
 #include "suppressor.h"
@@ -58,7 +63,7 @@ typedef char (*char2_table)
 typedef char (*chars_table)
 	[CHARSET_SIZE + 1][CHARSET_SIZE + 1][CHARSET_SIZE + 1];
 
-static unsigned int rec_entry, rec_length;
+static unsigned int rec_entry, rec_length, rec_compat;
 static unsigned char rec_numbers[CHARSET_LENGTH];
 
 static unsigned int hybrid_rec_entry, hybrid_rec_length;
@@ -77,11 +82,49 @@ static int regex_case;
 static char *regex;
 #endif
 
+#ifdef _OPENMP
+/*
+ * Number of candidates each thread generates per batch in the parallel
+ * generator, see inc_key_loop_par() below.
+ */
+#define INC_PAR_CHUNK			0x1000
+
+static int inc_threads;
+static char *par_buf;
+static int *par_count;
+static unsigned char par_base[CHARSET_LENGTH];
+static uint64_t par_pos;
+static int par_active, par_length, par_fixed;
+#endif
+
+/*
+ * Random access index, one element per charset order entry in use.  The
+ * counts are those in effect while the entry is processed.
+ */
+struct inc_entry {
+	unsigned int entry;
+	unsigned int length, fixed, count;
+	int counts[CHARSET_LENGTH];
+	inc_pos_t start, size;
+};
+
+static struct inc_entry *inc_entries;
+static unsigned int inc_entry_count;
+static inc_pos_t inc_keyspace;
+
+/* Our part of the keyspace when using --node or --fork */
+static int inc_balanced;
+static inc_pos_t node_start, node_end;
+
+static int inc_add(unsigned char *num, int length, int fixed,
+	const int *counts_length, inc_pos_t n);
+
 static void save_state(FILE *file)
 {
 	unsigned int pos;
 
-	fprintf(file, "%u\n2\n%u\n", rec_entry, rec_length + 1);
+	fprintf(file, "%u\n%u\n%u\n", rec_entry,
+	        (options.node_count && inc_balanced) ? 3 : 2, rec_length + 1);
 	for (pos = 0; pos <= rec_length; pos++)
 		fprintf(file, "%u\n", (unsigned int)rec_numbers[pos]);
 }
@@ -96,8 +139,9 @@ static int restore_state(FILE *file)
 	if (fscanf(file, "%u\n%u\n%u\n", &rec_entry, &compat, &rec_length) != 3)
 		return 1;
 	rec_length--; /* zero-based */
-	if (compat != 2 || rec_length >= CHARSET_LENGTH)
+	if (compat < 2 || compat > 3 || rec_length >= CHARSET_LENGTH)
 		return 1;
+	rec_compat = compat;
 	for (pos = 0; pos <= rec_length; pos++) {
 		unsigned int number;
 		if (fscanf(file, "%u\n", &number) != 1)
@@ -122,6 +166,14 @@ static void fix_state(void)
 	rec_entry = entry;
 	rec_length = length;
 	memcpy(rec_numbers, numbers, length);
+#ifdef _OPENMP
+	/* numbers[] is the start of the batch, add our position within it */
+	if (par_active) {
+		memcpy(rec_numbers, par_base, sizeof(rec_numbers));
+		inc_add(rec_numbers, par_length, par_fixed,
+		    counts[par_length], par_pos);
+	}
+#endif
 }
 
 void inc_hybrid_fix_state(void)
@@ -360,8 +412,332 @@ static void inc_new_count(unsigned int length, int count, const char *charset,
 		inc_format_error(charset);
 }
 
+/*
+ * Adds n to the state in num[], which is a mixed-radix number with the most
+ * significant digit at position 0 and the fixed position left alone.  This is
+ * the same order inc_key_loop() walks the entry in.  Returns non-zero if the
+ * result wrapped past the last candidate of the entry.
+ */
+static int inc_add(unsigned char *num, int length, int fixed,
+	const int *counts_length, inc_pos_t n)
+{
+	int pos;
+
+	for (pos = length; pos >= 0 && n; pos--) {
+		unsigned int radix, digit;
+
+		if (pos == fixed)
+			continue;
+
+		radix = counts_length[pos] + 1;
+		digit = num[pos] + n % radix;
+		n /= radix;
+		if (digit >= radix) {
+			digit -= radix;
+			n++;
+		}
+		num[pos] = digit;
+	}
+
+	return n != 0;
+}
+
+/*
+ * Walks the charset order table the same way do_incremental_crack() does,
+ * recording the counts, size and first candidate index of each entry in use.
+ */
+static void inc_build_index(struct charset_header *header,
+	int min_length, int max_length, int max_count)
+{
+	int counts_now[CHARSET_LENGTH][CHARSET_LENGTH];
+	unsigned int entry, alloc = 0;
+	unsigned char *ptr;
+
+	memset(counts_now, 0, sizeof(counts_now));
+	inc_entry_count = 0;
+	inc_keyspace = 0;
+
+	ptr = header->order;
+	for (entry = 0; ptr < &header->order[sizeof(header->order) - 1];
+	     entry++) {
+		struct inc_entry *e;
+		unsigned int length, fixed, count;
+		int pos;
+
+		length = *ptr++; fixed = *ptr++; count = *ptr++;
+
+		if (length >= CHARSET_LENGTH || fixed > length ||
+		    count >= real_count || (fixed && !count))
+			continue;
+
+		if ((int)length + 1 < min_length ||
+		    (int)length >= max_length ||
+		    (int)count >= max_count)
+			continue;
+
+		if (count)
+			counts_now[length][fixed]++;
+
+		if (inc_entry_count == alloc) {
+			alloc = alloc ? alloc * 2 : 0x100;
+			inc_entries = mem_realloc(inc_entries,
+			                          alloc * sizeof(*inc_entries));
+		}
+		e = &inc_entries[inc_entry_count++];
+
+		e->entry = entry;
+		e->length = length;
+		e->fixed = fixed;
+		e->count = count;
+		memcpy(e->counts, counts_now[length], sizeof(e->counts));
+
+		e->size = 1;
+		for (pos = 0; pos <= (int)length; pos++) {
+			inc_pos_t radix = e->counts[pos] + 1;
+
+			if (pos == (int)fixed)
+				continue;
+			if (e->size > INC_POS_MAX / radix)
+				e->size = INC_POS_MAX;
+			else
+				e->size *= radix;
+		}
+
+		e->start = inc_keyspace;
+		if (inc_keyspace > INC_POS_MAX - e->size)
+			inc_keyspace = INC_POS_MAX;
+		else
+			inc_keyspace += e->size;
+	}
+}
+
+static struct inc_entry *inc_find_entry(unsigned int entry)
+{
+	unsigned int lo = 0, hi = inc_entry_count;
+
+	while (lo < hi) {
+		unsigned int mid = lo + (hi - lo) / 2;
+
+		if (inc_entries[mid].entry < entry)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	if (lo < inc_entry_count && inc_entries[lo].entry == entry)
+		return &inc_entries[lo];
+
+	return NULL;
+}
+
+inc_pos_t inc_get_keyspace(void)
+{
+	return inc_keyspace;
+}
+
+inc_pos_t inc_entry_size(unsigned int entry)
+{
+	struct inc_entry *e = inc_find_entry(entry);
+
+	return e ? e->size : 0;
+}
+
+int inc_index_to_state(inc_pos_t index, unsigned int *entry,
+	unsigned char *numbers)
+{
+	unsigned int lo = 0, hi = inc_entry_count;
+	struct inc_entry *e;
+
+	if (inc_keyspace == INC_POS_MAX || index >= inc_keyspace)
+		return 1;
+
+	/* Find the last entry starting at or before index */
+	while (hi - lo > 1) {
+		unsigned int mid = lo + (hi - lo) / 2;
+
+		if (inc_entries[mid].start <= index)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	e = &inc_entries[lo];
+
+	memset(numbers, 0, CHARSET_LENGTH);
+	numbers[e->fixed] = e->count;
+	if (inc_add(numbers, e->length, e->fixed, e->counts,
+	            index - e->start))
+		return 1;
+
+	*entry = e->entry;
+
+	return 0;
+}
+
+int inc_state_to_index(unsigned int entry, const unsigned char *numbers,
+	inc_pos_t *index)
+{
+	struct inc_entry *e;
+	inc_pos_t offset = 0;
+	unsigned int pos;
+
+	if (inc_keyspace == INC_POS_MAX || !(e = inc_find_entry(entry)))
+		return 1;
+
+	for (pos = 0; pos <= e->length; pos++) {
+		if (pos == e->fixed)
+			continue;
+		if (numbers[pos] > e->counts[pos])
+			return 1;
+		offset = offset * (e->counts[pos] + 1) + numbers[pos];
+	}
+
+	*index = e->start + offset;
+
+	return 0;
+}
+
+/*
+ * Returns the first candidate index of the k'th of node_count equal parts
+ * of the keyspace.
+ */
+static inc_pos_t inc_node_part(unsigned int k)
+{
+	inc_pos_t q = inc_keyspace / options.node_count;
+	unsigned int r = inc_keyspace % options.node_count;
+
+	return q * k + (inc_pos_t)k * r / options.node_count;
+}
+
+#ifdef _OPENMP
+/*
+ * Writes up to max candidates starting at state num[] into out, each one
+ * NUL terminated and length + 2 bytes apart.  Returns the number of
+ * candidates written, which is less than max only if the entry ended.
+ * This must not touch any globals but the (read-only) tables, as it's
+ * called from several threads at once.
+ */
+static int inc_gen_keys(unsigned char *num, int length, int fixed,
+	const int *counts_length, char *char1, char2_table char2,
+	chars_table *chars, char *out, int max)
+{
+	char key[PLAINTEXT_BUFFER_SIZE];
+	int stride = length + 2;
+	int pos = 0, n = 0;
+
+	key[length + 1] = 0;
+	while (1) {
+		for (; pos <= length; pos++) {
+			if (pos == 0)
+				key[0] = char1[num[0]];
+			else if (pos == 1)
+				key[1] = (*char2)
+				    [ARCH_INDEX(key[0]) - CHARSET_MIN][num[1]];
+			else
+				key[pos] = (*chars[pos - 2])
+				    [ARCH_INDEX(key[pos - 2]) - CHARSET_MIN]
+				    [ARCH_INDEX(key[pos - 1]) - CHARSET_MIN]
+				    [num[pos]];
+		}
+		memcpy(out, key, stride);
+		out += stride;
+
+		if (++n >= max)
+			break;
+
+		for (pos = length; pos >= 0; pos--) {
+			if (pos == fixed)
+				continue;
+			if (++num[pos] <= counts_length[pos])
+				break;
+			num[pos] = 0;
+		}
+		if (pos < 0)
+			break;
+	}
+
+	return n;
+}
+
+/*
+ * Parallel version of inc_key_loop() for the plain (non-hybrid, unfiltered)
+ * case.  Each thread gets a disjoint, contiguous slice of the current entry
+ * and fills its own part of a shared batch buffer.  The batch is then fed to
+ * crk_process_key() in the exact order the serial loop would produce it, so
+ * session files are interchangeable between the two.
+ */
+static int inc_key_loop_par(int length, int fixed, int count,
+	char *char1, char2_table char2, chars_table *chars, inc_pos_t limit)
+{
+	int *counts_length = counts[length];
+	int stride = length + 2;
+	int done = 0;
+
+	numbers[fixed] = count;
+	par_length = length;
+	par_fixed = fixed;
+
+	do {
+		int t;
+
+#pragma omp parallel for num_threads(inc_threads)
+		for (t = 0; t < inc_threads; t++) {
+			unsigned char num[CHARSET_LENGTH];
+			inc_pos_t first = (inc_pos_t)t * INC_PAR_CHUNK;
+			int max = INC_PAR_CHUNK;
+
+			par_count[t] = 0;
+			if (first >= limit)
+				continue;
+			if (limit - first < (inc_pos_t)max)
+				max = limit - first;
+
+			memcpy(num, numbers, sizeof(num));
+			if (!inc_add(num, length, fixed, counts_length, first))
+				par_count[t] = inc_gen_keys(num, length, fixed,
+				    counts_length, char1, char2, chars,
+				    par_buf + (size_t)t * INC_PAR_CHUNK * stride,
+				    max);
+		}
+
+		memcpy(par_base, numbers, sizeof(par_base));
+		par_active = 1;
+		for (t = 0; t < inc_threads; t++) {
+			char *key = par_buf + (size_t)t * INC_PAR_CHUNK * stride;
+			int i;
+
+			for (i = 0; i < par_count[t]; i++, key += stride) {
+				par_pos = (uint64_t)t * INC_PAR_CHUNK + i;
+				if (crk_process_key(key)) {
+					inc_add(numbers, length, fixed,
+					    counts_length, par_pos);
+					par_active = 0;
+					return 1;
+				}
+			}
+			if (par_count[t] < INC_PAR_CHUNK) {
+				done = 1;
+				break;
+			}
+		}
+		par_active = 0;
+
+		if (!done) {
+			limit -= (inc_pos_t)inc_threads * INC_PAR_CHUNK;
+			done = !limit ||
+			    inc_add(numbers, length, fixed, counts_length,
+			    (inc_pos_t)inc_threads * INC_PAR_CHUNK);
+		}
+	} while (!done);
+
+	return 0;
+}
+#endif
+
+/*
+ * Tries up to limit candidates of the current entry, starting at numbers[].
+ */
 static int inc_key_loop(struct db_main *db, int length, int fixed, int count,
-	char *char1, char2_table char2, chars_table *chars)
+	char *char1, char2_table char2, chars_table *chars, inc_pos_t limit)
 {
 	char key_i[PLAINTEXT_BUFFER_SIZE];
 	char key_e[PLAINTEXT_BUFFER_SIZE];
@@ -372,6 +748,12 @@ static int inc_key_loop(struct db_main *db, int length, int fixed, int count,
 	int numbers_cache;
 	int pos;
 
+#ifdef _OPENMP
+	if (inc_threads > 1)
+		return inc_key_loop_par(length, fixed, count,
+		    char1, char2, chars, limit);
+#endif
+
 	key_i[length + 1] = 0;
 	numbers[fixed] = count;
 
@@ -428,6 +810,9 @@ update_last:
 		if (crk_process_key(key))
 			return 1;
 
+	if (!--limit)
+		return 0;
+
 	pos = length;
 	if (fixed < length) {
 		if (++numbers_cache <= counts_cache) {
@@ -751,6 +1136,26 @@ void do_incremental_crack(struct db_main *db, const char *mode)
 			chars[pos] = (chars_table)mem_alloc(sizeof(*chars[0]));
 	}
 
+#ifdef _OPENMP
+	if ((inc_threads = cfg_get_int(SECTION_OPTIONS, NULL,
+	                               "IncrementalThreads")) <= 0)
+		inc_threads = omp_get_max_threads();
+	if (f_new || f_filter || (options.flags & FLG_MASK_CHK))
+		inc_threads = 1;
+#if HAVE_REXGEN
+	if (regex)
+		inc_threads = 1;
+#endif
+	if (inc_threads > 1) {
+		par_buf = mem_alloc((size_t)inc_threads * INC_PAR_CHUNK *
+		                    (CHARSET_LENGTH + 1));
+		par_count = mem_alloc(inc_threads * sizeof(*par_count));
+		if (john_main_process)
+			log_event("- Generating candidates using %d threads",
+			          inc_threads);
+	}
+#endif
+
 	rec_entry = 0;
 	memset(rec_numbers, 0, sizeof(rec_numbers));
 
@@ -759,6 +1164,22 @@ void do_incremental_crack(struct db_main *db, const char *mode)
 	rec_restore_mode(restore_state);
 	rec_init(db, save_state);
 
+	inc_build_index(header, min_length, max_length, max_count);
+	if (options.node_count) {
+		if (rec_compat == 2)
+			log_event("- Restored session splits work by charset "
+			          "order entries");
+		else if (inc_keyspace == INC_POS_MAX)
+			log_event("- Keyspace too large to split evenly, "
+			          "splitting work by charset order entries");
+		else {
+			inc_balanced = 1;
+			node_start = inc_node_part(options.node_min - 1);
+			node_end = inc_node_part(options.node_max);
+			cand = (double)(node_end - node_start);
+		}
+	}
+
 	ptr = header->order;
 	entry = 0;
 	while (entry < rec_entry &&
@@ -801,8 +1222,10 @@ void do_incremental_crack(struct db_main *db, const char *mode)
 
 	entry--;
 	while (ptr < &header->order[sizeof(header->order) - 1]) {
+		struct inc_entry *e;
+		inc_pos_t limit = INC_POS_MAX;
 		int skip = 0;
-		if (options.node_count) {
+		if (options.node_count && !inc_balanced) {
 			int for_node = entry % options.node_count + 1;
 			skip = for_node < options.node_min ||
 			    for_node > options.node_max;
@@ -829,6 +1252,26 @@ void do_incremental_crack(struct db_main *db, const char *mode)
 		    (int)count >= max_count)
 			continue;
 
+		if (inc_balanced && (e = inc_find_entry(entry))) {
+			inc_pos_t pos = e->start, end = e->start + e->size;
+
+			if (entry == rec_entry &&
+			    inc_state_to_index(entry, numbers, &pos))
+				pos = e->start;
+			if (pos < node_start) {
+				unsigned int dummy;
+
+				pos = node_start;
+				inc_index_to_state(pos, &dummy, numbers);
+			}
+			if (end > node_end)
+				end = node_end;
+			if (pos < end)
+				limit = end - pos;
+			else
+				skip = 1;
+		}
+
 		if (!skip) {
 			int i, max_count = 0;
 			if ((int)length != last_length) {
@@ -891,7 +1334,8 @@ void do_incremental_crack(struct db_main *db, const char *mode)
 		log_event("- Trying length %d, fixed @%d, character count %d",
 		    length + 1, fixed + 1, counts[length][fixed] + 1);
 
-		if (inc_key_loop(db, length, fixed, count, char1, char2, chars))
+		if (inc_key_loop(db, length, fixed, count, char1, char2, chars,
+		                 limit))
 			break;
 	}
 
@@ -910,6 +1354,11 @@ void do_incremental_crack(struct db_main *db, const char *mode)
 		MEM_FREE(chars[pos]);
 	MEM_FREE(char2);
 	MEM_FREE(header);
+	MEM_FREE(inc_entries);
+#ifdef _OPENMP
+	MEM_FREE(par_count);
+	MEM_FREE(par_buf);
+#endif
 
 	fclose(file);
 }
@@ -10,11 +10,49 @@
 #ifndef _JOHN_INC_H
 #define _JOHN_INC_H
 
+#include <stdint.h>
+
 #include "loader.h"
 
+/*
+ * Candidate index within the incremental mode keyspace.  The keyspace of a
+ * long run easily exceeds 64 bits, so use 128-bit where we can.  Indices
+ * saturate at INC_POS_MAX, and the functions below refuse to work when the
+ * keyspace doesn't fit.
+ */
+#ifdef __SIZEOF_INT128__
+typedef unsigned __int128 inc_pos_t;
+#else
+typedef uint64_t inc_pos_t;
+#endif
+#define INC_POS_MAX			((inc_pos_t)~(inc_pos_t)0)
+
 /*
  * Runs the incremental mode cracker.
  */
 extern void do_incremental_crack(struct db_main *db, const char *mode);
 
+/*
+ * Random access to the keyspace of the running incremental mode session,
+ * which is the concatenation of all charset order entries in use (entry
+ * numbers are positions in the charset file's order table).  The empty
+ * string, if tried, is not part of it.
+ *
+ * inc_get_keyspace() returns the total number of candidates, or INC_POS_MAX
+ * if that doesn't fit an inc_pos_t (in which case the other functions fail).
+ * inc_entry_size() returns the number of candidates in an entry, or zero if
+ * the entry is not used with the current settings.
+ */
+extern inc_pos_t inc_get_keyspace(void);
+extern inc_pos_t inc_entry_size(unsigned int entry);
+
+/*
+ * Map a candidate index to an entry number and its state (the same numbers
+ * as stored in session files) and back.  These return non-zero on failure.
+ */
+extern int inc_index_to_state(inc_pos_t index, unsigned int *entry,
+	unsigned char *numbers);
+extern int inc_state_to_index(unsigned int entry, const unsigned char *numbers,
+	inc_pos_t *index);
+
 #endif
@@ -89,10 +89,14 @@ static int john_omp_threads_new;
 #include "loader.h"
 #include "logger.h"
 #include "status.h"
+#include "metrics.h"
 #include "recovery.h"
 #include "options.h"
 #include "config.h"
 #include "bench.h"
+#include "genbench.h"
+#include "lookbench.h"
+#include "affinity.h"
 #ifdef HAVE_FUZZ
 #include "fuzz.h"
 #endif
@@ -389,6 +393,15 @@ static void john_omp_fallback(char **argv) {
 
 static void john_omp_maybe_adjust_or_fallback(char **argv)
 {
+	int cores = affinity_threads();
+
+	/* --pin=cores, leave SMT siblings idle */
+	if (cores && cores < john_omp_threads_new &&
+	    !getenv("OMP_NUM_THREADS")) {
+		omp_set_num_threads(cores);
+		john_omp_threads_new = cores;
+	}
+
 	if (options.fork && !getenv("OMP_NUM_THREADS")) {
 		john_omp_threads_new /= options.fork;
 		if (john_omp_threads_new < 1)
@@ -574,6 +587,7 @@ static void john_fork(void)
 			}
 			options.node_min += i * npf;
 			options.node_max = options.node_min + npf - 1;
+			affinity_pin(i, options.fork, 0);
 #if HAVE_OPENCL
 			/* Poor man's multi-device support */
 			if (options.acc_devices->count &&
@@ -600,6 +614,7 @@ static void john_fork(void)
 	}
 
 	options.node_max = options.node_min + npf - 1;
+	affinity_pin(0, options.fork, 0);
 
 #if HAVE_OPENCL
 	/* Poor man's multi-device support */
@@ -684,7 +699,17 @@ static void john_wait(void)
  */
 	while (waiting_for) {
 		int i, status;
-		int pid = wait(&status);
+		int pid;
+
+		if (metrics_enabled) {
+			/* Keep reporting our children's figures meanwhile */
+			while (!(pid = waitpid(-1, &status, WNOHANG))) {
+				if (event_metrics)
+					metrics_update();
+				sleep(1);
+			}
+		} else
+			pid = wait(&status);
 		if (pid == -1) {
 			if (errno != EINTR)
 				perror("wait");
@@ -1356,6 +1381,9 @@ static void john_load(void)
 	john_omp_show_info();
 #endif
 
+	/* Before forking, so children share its slots */
+	metrics_init();
+
 	if (options.node_count) {
 		if (john_main_process && options.node_min != options.node_max) {
 			log_event("- Node numbers %u-%u of %u%s",
@@ -1574,9 +1602,17 @@ static void john_init(char *name, int argc, char **argv)
 	/* Stuff that need to be reset again after rec_restore_args */
 	john_set_tristates();
 
+	affinity_init();
 #ifdef _OPENMP
 	john_omp_maybe_adjust_or_fallback(argv);
 #endif
+	/* With --fork, each process pins itself once forked */
+	if (!options.fork
+#if HAVE_MPI
+	    && mpi_p == 1
+#endif
+	    )
+		affinity_pin(0, 1, 0);
 	omp_autotune_init();
 	if (!(options.flags & FLG_STDOUT))
 		john_register_all(); /* maybe restricted to one format by options */
@@ -1679,6 +1715,10 @@ static void john_run(void)
 
 	if (options.flags & FLG_TEST_CHK)
 		exit_status = benchmark_all() ? 1 : 0;
+	else if (options.flags & FLG_GENBENCH_CHK)
+		exit_status = genbench_run() ? 1 : 0;
+	else if (options.flags & FLG_LOOKUP_CHK)
+		exit_status = lookbench_run() ? 1 : 0;
 #ifdef HAVE_FUZZ
 	else
 	if (options.flags & FLG_FUZZ_CHK || options.flags & FLG_FUZZ_DUMP_CHK) {
@@ -1914,6 +1954,8 @@ static void john_run(void)
 
 static void john_done(void)
 {
+	metrics_done();
+
 	if ((options.flags & (FLG_CRACKING_CHK | FLG_STDOUT)) ==
 	    FLG_CRACKING_CHK) {
 		if (!event_abort && mask_iter_warn) {
@@ -87,6 +87,12 @@ struct db_keys {
 /* Number of keys currently in the buffer */
 	int count;
 
+/* Number of keys the buffer currently has room for, grown on demand */
+	int size;
+
+/* Bytes of single mode's buffer size limit this buffer is counted for */
+	uint64_t charged;
+
 /* Number of keys currently in the buffer that came from successful guesses
  * for other salts and thus are being tried for all salts */
 	int count_from_guesses;
@@ -102,8 +108,8 @@ struct db_keys {
 /* Number of recursive calls for this salt */
 	int lock;
 
-/* The keys, allocated as (plaintext_length * min_keys_per_crypt) bytes */
-	char buffer[1];
+/* The keys, allocated as (plaintext_length * size) bytes */
+	char *buffer;
 };
 
 /*
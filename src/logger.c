@@ -59,6 +59,13 @@
 #include "signals.h"
 #include "logger.h"
 
+#if HAVE_PTHREAD && !(__DJGPP__ || _MSC_VER || __MINGW32__ || __MINGW64__ || __CYGWIN__ || HAVE_WINDOWS_H)
+#define LOG_ASYNC			1
+#include <pthread.h>
+#else
+#define LOG_ASYNC			0
+#endif
+
 static int cfg_beep;
 static int cfg_log_passwords;
 static int cfg_showcand;
@@ -100,8 +107,15 @@ struct log_file {
 	char *buffer, *ptr;
 	int size;
 	int fd;
+#if LOG_ASYNC
+	char *spare;
+	int queued;
+#endif
 };
 
+#define LOG_BUFFER_EXTRA \
+	(LINE_BUFFER_SIZE + PLAINTEXT_BUFFER_SIZE + 64)
+
 #ifdef _MSC_VER
 // In release mode, the log() function gets in the way of our log struct object
 #define log local_log_struct
@@ -114,6 +128,21 @@ static char *admin_start, *admin_end, *admin_string, *terminal_reset;
 static char *other_start, *other_end;
 static int in_logger, show_admins;
 
+#if LOG_ASYNC
+/*
+ * While cracking, log_guess() hands full buffers over to a writer thread,
+ * which takes the lock and writes them out while we fill the spare buffer.
+ * At most one buffer per file is queued, so a burst of guesses that outpaces
+ * the disk eventually waits for it.  Any other write waits for the queued
+ * one first, keeping the lines in order.
+ */
+static pthread_mutex_t log_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t log_cond = PTHREAD_COND_INITIALIZER;
+static int log_async = -1, log_errno;
+/* Number of log_sync() calls using the fds, which mustn't be closed meanwhile */
+static int log_syncing;
+#endif
+
 #if !(__MINGW32__ || _MSC_VER)
 
 /*
@@ -212,11 +241,118 @@ static void log_file_init(struct log_file *f, char *name, char *perms, int size)
 	 * longer have to check length before a write (.pot or .log file).
 	 * The "64" comes from core.
 	 */
-	f->ptr = f->buffer =
-		mem_alloc(size + LINE_BUFFER_SIZE + PLAINTEXT_BUFFER_SIZE + 64);
+	f->ptr = f->buffer = mem_alloc(size + LOG_BUFFER_EXTRA);
 	f->size = size;
 }
 
+#if LOG_ASYNC
+/*
+ * Writes out the buffer queued by log_file_queue().  Runs in the writer
+ * thread, so it returns an errno value instead of exiting.
+ */
+static int log_file_write_queued(struct log_file *f)
+{
+	struct flock lock;
+	long int pos_b4 = 0;
+
+	/* Same as jtr_lock(), which may log and exit */
+	memset(&lock, 0, sizeof(lock));
+	lock.l_type = F_WRLCK;
+	while (fcntl(f->fd, F_SETLKW, &lock)) {
+		if (errno == EAGAIN)
+			usleep(100000);
+		else if (errno != EINTR)
+			return errno;
+	}
+
+	if (f == &pot)
+		pos_b4 = (long int)lseek(f->fd, 0, SEEK_END);
+
+	if (write_loop(f->fd, f->spare, f->queued) < 0)
+		return errno;
+
+	if (f == &pot && pos_b4 == crk_pot_pos)
+		crk_pot_pos += f->queued;
+
+	lock.l_type = F_UNLCK;
+	fcntl(f->fd, F_SETLK, &lock);
+
+	return 0;
+}
+
+static void *log_writer(void *arg)
+{
+	pthread_mutex_lock(&log_mutex);
+	while (1) {
+		struct log_file *f = pot.queued ? &pot : log.queued ? &log : NULL;
+		int error;
+
+		if (!f) {
+			pthread_cond_wait(&log_cond, &log_mutex);
+			continue;
+		}
+		pthread_mutex_unlock(&log_mutex);
+
+		error = log_file_write_queued(f);
+
+		pthread_mutex_lock(&log_mutex);
+		if (error && !log_errno)
+			log_errno = error;
+		f->queued = 0;
+		pthread_cond_broadcast(&log_cond);
+	}
+
+	return NULL;
+}
+
+/*
+ * Started on the first burst of guesses, that is after any --fork.  Not used
+ * with --reload-at-crack, which wants each write signalled right away.
+ */
+static void log_start_writer(void)
+{
+	sigset_t all, old;
+	pthread_t thread;
+
+	log_async = 0;
+	if (options.reload_at_crack ||
+	    !cfg_get_bool(SECTION_OPTIONS, NULL, "SaveInBackground", 1))
+		return;
+
+	/* Leave the signals to the main thread */
+	sigfillset(&all);
+	pthread_sigmask(SIG_SETMASK, &all, &old);
+	if (!pthread_create(&thread, NULL, log_writer, NULL)) {
+		pthread_detach(thread);
+		log_async = 1;
+	}
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+}
+
+/*
+ * Waits for the writer thread to be done with the file.
+ */
+static void log_file_wait(struct log_file *f)
+{
+	int error;
+
+	if (log_async <= 0)
+		return;
+
+	pthread_mutex_lock(&log_mutex);
+	while (f->queued)
+		pthread_cond_wait(&log_cond, &log_mutex);
+	error = log_errno;
+	log_errno = 0;
+	pthread_mutex_unlock(&log_mutex);
+
+	if (error) {
+		errno = error;
+		pexit("write");
+	}
+}
+#endif
+
 static void log_file_flush(struct log_file *f)
 {
 	int count;
@@ -224,6 +360,10 @@ static void log_file_flush(struct log_file *f)
 
 	if (f->fd < 0) return;
 
+#if LOG_ASYNC
+	log_file_wait(f);
+#endif
+
 	count = f->ptr - f->buffer;
 	if (count <= 0) return;
 
@@ -281,6 +421,40 @@ static int log_file_write(struct log_file *f)
 	return 0;
 }
 
+/*
+ * Same as log_file_flush(), but leaves the writing to the writer thread if
+ * there's one.
+ */
+static void log_file_queue(struct log_file *f)
+{
+#if LOG_ASYNC
+	if (log_async < 0)
+		log_start_writer();
+
+	if (log_async > 0 && f->fd >= 0) {
+		char *buffer;
+
+		if (f->ptr == f->buffer)
+			return;
+		if (!f->spare)
+			f->spare = mem_alloc(f->size + LOG_BUFFER_EXTRA);
+
+		log_file_wait(f);
+
+		pthread_mutex_lock(&log_mutex);
+		buffer = f->spare;
+		f->spare = f->buffer;
+		f->queued = f->ptr - f->buffer;
+		f->ptr = f->buffer = buffer;
+		pthread_cond_broadcast(&log_cond);
+		pthread_mutex_unlock(&log_mutex);
+		return;
+	}
+#endif
+
+	log_file_flush(f);
+}
+
 static void log_file_fsync(struct log_file *f)
 {
 	if (f->fd < 0) return;
@@ -293,16 +467,31 @@ static void log_file_fsync(struct log_file *f)
 
 static void log_file_done(struct log_file *f, int do_sync)
 {
+	int fd;
+
 	if (f->fd < 0) return;
 
 	if (do_sync)
 		log_file_fsync(f);
 	else
 		log_file_flush(f);
-	if (close(f->fd)) pexit("close");
+
+#if LOG_ASYNC
+	pthread_mutex_lock(&log_mutex);
+	while (log_syncing)
+		pthread_cond_wait(&log_cond, &log_mutex);
+#endif
+	fd = f->fd;
 	f->fd = -1;
+#if LOG_ASYNC
+	pthread_mutex_unlock(&log_mutex);
+#endif
+	if (close(fd)) pexit("close");
 
 	MEM_FREE(f->buffer);
+#if LOG_ASYNC
+	MEM_FREE(f->spare);
+#endif
 }
 
 static int log_time(void)
@@ -611,11 +800,11 @@ void log_guess(char *login, char *uid, char *ciphertext, char *rep_plain,
 	}
 
 /* Try to keep the two files in sync */
-	if (log_file_write(&pot))
-		log_file_flush(&log);
-	else
-	if (log_file_write(&log))
-		log_file_flush(&pot);
+	if ((pot.fd >= 0 && pot.ptr - pot.buffer > pot.size) ||
+	    (log.fd >= 0 && log.ptr - log.buffer > log.size)) {
+		log_file_queue(&pot);
+		log_file_queue(&log);
+	}
 
 	in_logger = 0;
 
@@ -716,6 +905,72 @@ void log_flush(void)
 	in_logger = 0;
 }
 
+void log_write(void)
+{
+	in_logger = 1;
+
+	log_file_queue(&log);
+	log_file_queue(&pot);
+
+	in_logger = 0;
+}
+
+void log_wait(void)
+{
+#if LOG_ASYNC
+	log_file_wait(&pot);
+	log_file_wait(&log);
+#endif
+}
+
+unsigned int log_queued(void)
+{
+	unsigned int count = 0;
+
+#if LOG_ASYNC
+	pthread_mutex_lock(&log_mutex);
+	count = log.queued + pot.queued;
+	pthread_mutex_unlock(&log_mutex);
+#endif
+
+	return count;
+}
+
+int log_sync(void)
+{
+	int log_fd, pot_fd, error = 0;
+
+#if LOG_ASYNC
+	pthread_mutex_lock(&log_mutex);
+	while (log.queued || pot.queued)
+		pthread_cond_wait(&log_cond, &log_mutex);
+	log_syncing++;
+#endif
+	log_fd = options.fork ? -1 : log.fd;
+	pot_fd = pot.fd;
+#if LOG_ASYNC
+	pthread_mutex_unlock(&log_mutex);
+#endif
+
+#if !HAVE_WINDOWS_H
+	if ((log_fd >= 0 && fsync(log_fd)) || (pot_fd >= 0 && fsync(pot_fd)))
+		error = errno;
+#endif
+
+#if LOG_ASYNC
+	pthread_mutex_lock(&log_mutex);
+	log_syncing--;
+	pthread_cond_broadcast(&log_cond);
+	pthread_mutex_unlock(&log_mutex);
+#endif
+
+	if (error) {
+		errno = error;
+		return -1;
+	}
+	return 0;
+}
+
 void log_done(void)
 {
 /*
@@ -86,6 +86,27 @@ extern void log_discard(void);
  */
 extern void log_flush(void);
 
+/*
+ * The two halves of log_flush(): hands the buffers to the writer thread (or
+ * writes them out if there's none), and waits for that and syncs the files
+ * to disk.  log_sync() doesn't touch the buffers, so it may be called from
+ * another thread; it returns -1 with errno set on failure instead of exiting.
+ */
+extern void log_write(void);
+extern int log_sync(void);
+
+/*
+ * Waits for the writer thread to write out what it was handed, so that the
+ * pot file may be read back.
+ */
+extern void log_wait(void);
+
+/*
+ * Returns the number of bytes handed to the writer thread that it hasn't
+ * written out yet.
+ */
+extern unsigned int log_queued(void);
+
 /*
  * Closes john.pot and the log file.
  */
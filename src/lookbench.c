@@ -0,0 +1,390 @@
+/*
+ * This file is part of John the Ripper password cracker.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted.
+ *
+ * There's ABSOLUTELY NO WARRANTY, express or implied.
+ */
+
+#define NEED_OS_FORK
+#include "os.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <sys/time.h>
+#if (!AC_BUILT || HAVE_UNISTD_H) && !_MSC_VER
+#include <unistd.h>
+#endif
+#if OS_FORK
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+#include "arch.h"
+#include "misc.h"
+#include "params.h"
+#include "memory.h"
+#include "options.h"
+#include "config.h"
+#include "formats.h"
+#include "dyna_salt.h"
+#include "loader.h"
+#include "status.h"
+#include "signals.h"
+#include "cracker.h"
+#include "omp_autotune.h"
+#include "prof.h"
+#include "bench.h"
+#include "lookbench.h"
+
+#define LOOKBENCH_SIZES			"1 1K 1M 10M 100M"
+
+/* Candidates between looks at the clock */
+#define LOOKBENCH_CHUNK			0x400
+
+int lookbench_time = LOOKBENCH_TIME;
+
+static double lookbench_now(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+
+	return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+static void lookbench_label(unsigned int count)
+{
+	printf("%10u %-8s", count, count != 1 ? "hashes:" : "hash:");
+}
+
+/*
+ * Parses the next count, with an optional K, M or G suffix.  Returns 0 at the
+ * end of the list.
+ */
+static unsigned int lookbench_next_size(const char **list)
+{
+	const char *p = *list;
+	char *end;
+	unsigned long long count;
+
+	while (*p == ' ' || *p == '\t' || *p == ',')
+		p++;
+	if (!*p)
+		return 0;
+
+	count = strtoull(p, &end, 10);
+	switch (*end) {
+	case 'k': case 'K':
+		count *= 1000;
+		end++;
+		break;
+	case 'm': case 'M':
+		count *= 1000000;
+		end++;
+		break;
+	case 'g': case 'G':
+		count *= 1000000000;
+		end++;
+		break;
+	}
+
+	if (end == p || (*end && *end != ' ' && *end != '\t' && *end != ',') ||
+	    !count || count > 0x7fffffff)
+		error_msg("Invalid LookupBenchmarkSizes: %s\n", p);
+
+	*list = end;
+
+	return count;
+}
+
+/*
+ * Which bitmap ldr_init_hash() would pick, ignoring what the format supports.
+ */
+static int lookbench_hash_size(unsigned int count)
+{
+	int size = -1;
+
+	if (count >= password_hash_thresholds[0] && mem_saving_level < 3)
+		for (size = PASSWORD_HASH_SIZES - 1; size > 0; size--)
+			if (count >= password_hash_thresholds[size])
+				break;
+
+	if (mem_saving_level >= 2)
+		size--;
+
+	return size;
+}
+
+static int64_t lookbench_mem_needed(struct fmt_main *format,
+	unsigned int count)
+{
+	int64_t bitmap, needed;
+	int size = lookbench_hash_size(count);
+
+	needed = (int64_t)count * (sizeof(struct db_password) +
+		format->params.binary_size + format->params.binary_align);
+
+	if (size >= 0) {
+		bitmap = password_hash_sizes[size];
+		needed += bitmap / 8 +
+			(bitmap >> PASSWORD_HASH_SHR) * sizeof(struct db_password *);
+	}
+
+	return needed;
+}
+
+/*
+ * Loads count random binaries into db, the way ldr_load_pw_line() would for
+ * a single salt.  The binaries come from one block, which is returned in
+ * *blocks along with that of the password entries.
+ */
+static void lookbench_init_db(struct db_main *db, struct fmt_main *format,
+	unsigned int count, void **blocks)
+{
+	struct fmt_tests *test = format->params.tests;
+	struct db_salt *salt;
+	struct db_password *pw;
+	char *fields[10], *ciphertext, *binaries;
+	void *salt_data;
+	size_t pw_size, bin_size;
+	uint64_t x = 0x9e3779b97f4a7c15ULL;
+	unsigned int i;
+	int j;
+
+	ldr_init_database(db, &options.loader);
+	db->format = format;
+
+	memcpy(fields, test->fields, sizeof(fields));
+	if (!fields[1])
+		fields[1] = test->ciphertext;
+	ciphertext = format->methods.split(
+		format->methods.prepare(fields, format), 0, format);
+	ciphertext = str_alloc_copy(ciphertext);
+
+	salt_data = format->methods.salt(ciphertext);
+	dyna_salt_create(salt_data);
+
+	salt = mem_alloc_tiny(db->salt_size, MEM_ALIGN_WORD);
+	memset(salt, 0, db->salt_size);
+	salt->salt = mem_alloc_copy(salt_data, format->params.salt_size,
+		format->params.salt_align);
+	for (j = 0; j < FMT_TUNABLE_COSTS &&
+	     format->methods.tunable_cost_value[j]; j++)
+		salt->cost[j] =
+			format->methods.tunable_cost_value[j](salt->salt);
+	salt->index = fmt_dummy_hash;
+	salt->hash = &salt->list;
+	salt->hash_size = -1;
+	salt->count = count;
+
+	db->salt_hash[format->methods.salt_hash(salt->salt)] = salt;
+	db->salt_count = 1;
+	db->password_count = count;
+
+	pw_size = db->pw_size;
+	bin_size = format->params.binary_size;
+	if (format->params.binary_align > 1)
+		bin_size = (bin_size + format->params.binary_align - 1) /
+			format->params.binary_align * format->params.binary_align;
+
+	blocks[0] = mem_alloc(pw_size * count);
+	blocks[1] = binaries = mem_alloc_align(bin_size * count,
+		format->params.binary_align);
+
+	for (i = 0; i < count; i++) {
+		uint32_t *word;
+		size_t left;
+
+		pw = (struct db_password *)((char *)blocks[0] + pw_size * i);
+		pw->binary = binaries + bin_size * i;
+		pw->next = salt->list;
+		pw->next_hash = NULL;
+		pw->source = ciphertext;
+		salt->list = pw;
+
+		/* Some other hash that won't crack, whatever binary_hash() looks at */
+		for (word = pw->binary, left = format->params.binary_size;
+		     left >= 4; left -= 4) {
+			x ^= x << 13;
+			x ^= x >> 7;
+			x ^= x << 17;
+			*word++ = (uint32_t)(x >> 32);
+		}
+		if (left)
+			memcpy(word, &x, left);
+	}
+
+	ldr_fix_database(db);
+}
+
+/*
+ * Runs one size and prints its line.
+ */
+static void lookbench_one(struct fmt_main *format, unsigned int count)
+{
+	struct db_main db;
+	void *blocks[2];
+	char key[PLAINTEXT_BUFFER_SIZE], s_cps[32], s_size[16];
+	double start, elapsed, total, lookup_ns;
+	uint64_t cands;
+	int length, i, stage;
+
+	lookbench_init_db(&db, format, count, blocks);
+
+	omp_autotune_run(&db);
+	format->methods.reset(&db);
+
+	length = MIN(8, format->params.plaintext_length);
+	memset(key, 'a', length);
+	key[length] = 0;
+
+	status_init(NULL, 1);
+	options.profile = 1;
+	crk_init(&db, NULL, NULL);
+
+	start = lookbench_now();
+	do {
+		for (i = 0; i < LOOKBENCH_CHUNK; i++) {
+			char *p = &key[length - 1];
+
+			while (p > key && *p == 'z')
+				*p-- = 'a';
+			(*p)++;
+
+			if (crk_process_key(key))
+				break;
+		}
+	} while (i == LOOKBENCH_CHUNK && !event_abort &&
+	         lookbench_now() - start < lookbench_time);
+	crk_done();
+	elapsed = lookbench_now() - start;
+	prof_switch(prof_stage);
+	prof_enabled = 0;
+
+	cands = status.cands;
+	for (total = 0, stage = 0; stage < PROF_STAGES; stage++)
+		total += prof_ticks[stage];
+	lookup_ns = (total && cands) ?
+		prof_ticks[PROF_LOOKUP] / total * elapsed * 1e9 / cands : 0;
+
+	benchmark_cps(cands, elapsed * clk_tck, s_cps);
+	lookbench_label(count);
+	if (db.salts && db.salts->hash_size >= 0)
+		snprintf(s_size, sizeof(s_size), "%d", db.salts->hash_size);
+	else
+		strcpy(s_size, "none");
+	printf("%s c/s real, lookup %.1f ns/c, hash size %s\n",
+	       s_cps, lookup_ns, s_size);
+	fflush(stdout);
+
+	MEM_FREE(blocks[0]);
+	MEM_FREE(blocks[1]);
+	ldr_free_db(&db, 0);
+}
+
+/*
+ * Runs one size in a child process where we can, so each starts from a clean
+ * heap and cracker state.  Returns non-zero if the child didn't finish cleanly.
+ */
+static int lookbench_size(struct fmt_main *format, unsigned int count)
+{
+#if OS_FORK
+	pid_t pid;
+	int wstatus;
+
+	fflush(stdout);
+	fflush(stderr);
+
+	switch ((pid = fork())) {
+	case -1:
+		pexit("fork");
+
+	case 0:
+		lookbench_one(format, count);
+		_exit(0);
+	}
+
+	while (waitpid(pid, &wstatus, 0) < 0 && errno == EINTR)
+		;
+
+	if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus)) {
+		lookbench_label(count);
+		puts("FAILED");
+		return 1;
+	}
+
+	return 0;
+#else
+	lookbench_one(format, count);
+	return 0;
+#endif
+}
+
+int lookbench_run(void)
+{
+	struct fmt_main *format;
+	const char *sizes;
+	int failed = 0;
+	int64_t avail = host_avail_mem();
+
+	if (!(sizes = cfg_get_param(SECTION_OPTIONS, NULL,
+	                            "LookupBenchmarkSizes")))
+		sizes = LOOKBENCH_SIZES;
+
+	if (lookbench_time < 1)
+		lookbench_time = 1;
+
+	for (format = fmt_list; format && !event_abort; format = format->next) {
+		struct db_main *test_db;
+		char *result;
+		const char *list = sizes;
+		unsigned int count;
+
+		printf("Benchmarking lookup: %s%s%s [%s]... ",
+		       format->params.label,
+		       format->params.format_name[0] ? ", " : "",
+		       format->params.format_name,
+		       format->params.algorithm_name);
+		fflush(stdout);
+
+		if (format->params.salt_size ||
+		    (format->params.flags & (FMT_BLOB | FMT_DYNA_SALT)) ||
+		    !format->params.binary_size || !format->params.tests) {
+			puts("skipped (not an unsalted hash)");
+			continue;
+		}
+
+		fmt_init(format);
+		test_db = ldr_init_test_db(format, NULL);
+		result = fmt_self_test(format, test_db);
+		ldr_free_db(test_db, 1);
+		if (result) {
+			printf("FAILED (%s)\n", result);
+			failed++;
+			continue;
+		}
+		puts("PASS");
+
+		while (!event_abort && (count = lookbench_next_size(&list))) {
+			int64_t needed = lookbench_mem_needed(format, count);
+
+			if (avail > 0 && needed > avail) {
+				lookbench_label(count);
+				printf("skipped (needs about %sB, have %sB)\n",
+				       human_prefix(needed), human_prefix(avail));
+				continue;
+			}
+
+			if (lookbench_size(format, count))
+				failed++;
+		}
+		puts("");
+	}
+
+	return failed;
+}
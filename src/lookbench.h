@@ -0,0 +1,34 @@
+/*
+ * This file is part of John the Ripper password cracker.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted.
+ *
+ * There's ABSOLUTELY NO WARRANTY, express or implied.
+ */
+
+/*
+ * Hash lookup scaling benchmark (--test-lookup).
+ *
+ * For each selected unsalted format and each count listed in the
+ * LookupBenchmarkSizes setting, we load that many random binaries into a
+ * database as the loader would (so ldr_fix_database() sizes the bitmap and
+ * hash table), then feed candidates that never crack through the usual
+ * crk_process_key() path for a while.  The --test figures only ever see a
+ * few loaded hashes; these show what the lookup costs at scale.
+ */
+
+#ifndef _JOHN_LOOKBENCH_H
+#define _JOHN_LOOKBENCH_H
+
+/*
+ * Seconds to run each size for.
+ */
+extern int lookbench_time;
+
+/*
+ * Runs the benchmark, returning non-zero if any format failed.
+ */
+extern int lookbench_run(void);
+
+#endif
@@ -0,0 +1,339 @@
+/*
+ * This file is part of John the Ripper password cracker.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted.
+ *
+ * There's ABSOLUTELY NO WARRANTY, express or implied.
+ */
+
+#define NEED_OS_FORK
+#include "os.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/time.h>
+#if (!AC_BUILT || HAVE_UNISTD_H) && !_MSC_VER
+#include <unistd.h>
+#endif
+#if _MSC_VER
+#include <io.h>
+#include <process.h>
+#endif
+
+#include "arch.h"
+#include "misc.h"
+#include "params.h"
+#include "path.h"
+#include "memory.h"
+#include "options.h"
+#include "config.h"
+#include "status.h"
+#include "john.h"
+#include "john_mpi.h"
+#include "signals.h"
+#include "logger.h"
+#include "cracker.h"
+#include "metrics.h"
+
+#if HAVE_MMAP && OS_FORK
+#include <sys/mman.h>
+#endif
+
+#define METRICS_DEFAULT_INTERVAL	10
+
+/*
+ * One per process.  Only its owner writes it, bumping seq before and after so
+ * the reader can tell a torn copy.
+ */
+struct metrics_slot {
+	volatile unsigned int seq;
+	unsigned int node, pid;
+	int done;
+	double time, progress;
+	unsigned int guesses, passwords_left, salts, salts_left;
+	uint64_t cands, crypts, suppressed, passed;
+	double combs;
+	uint64_t crypt_calls, crypt_keys;
+	double crypt_time, crypt_max;
+	unsigned int max_keys, last_keys;
+	unsigned int keys_queued, log_queued;
+};
+
+int metrics_enabled;
+
+static struct metrics_slot *slots, *own;
+static int slot_count, writer, fd = -1;
+static unsigned int base_node, node_step;
+static struct metrics_slot prev_total;
+static char *record;
+
+/* Counters kept between snapshots, as crypt_all() runs far more often */
+static uint64_t crypt_calls, crypt_keys;
+static double crypt_time, crypt_max;
+static unsigned int max_keys, last_keys, first_salts;
+static struct timeval crypt_started;
+
+static double seconds(struct timeval *tv)
+{
+	return tv->tv_sec + tv->tv_usec / 1000000.0;
+}
+
+void metrics_init(void)
+{
+	if (!options.metrics_file || metrics_enabled)
+		return;
+
+	if ((options.metrics_interval = cfg_get_int(SECTION_OPTIONS, NULL,
+	                                            "MetricsInterval")) <= 0)
+		options.metrics_interval = METRICS_DEFAULT_INTERVAL;
+
+	slot_count = options.fork ? options.fork : 1;
+	base_node = options.node_min;
+	node_step = options.fork ?
+		(options.node_max - options.node_min + 1) / options.fork : 1;
+
+#if HAVE_MMAP && OS_FORK && defined(MAP_ANON)
+	if (slot_count > 1) {
+		slots = mmap(NULL, slot_count * sizeof(*slots),
+		             PROT_READ | PROT_WRITE, MAP_ANON | MAP_SHARED, -1, 0);
+		if (slots == MAP_FAILED)
+			pexit("mmap");
+		memset(slots, 0, slot_count * sizeof(*slots));
+	} else
+#endif
+	{
+		slot_count = 1;
+		slots = mem_calloc(1, sizeof(*slots));
+	}
+
+	/* Totals take about 700 bytes, each node about 300 */
+	record = mem_alloc(1024 + slot_count * 512);
+
+	if ((fd = open(path_expand(options.metrics_file),
+	               O_WRONLY | O_CREAT | O_APPEND, 0600)) < 0)
+		pexit("open: %s", path_expand(options.metrics_file));
+
+	metrics_enabled = 1;
+}
+
+static void snapshot(int done)
+{
+	double progress = -1;
+
+	if (!own) {
+		int i = node_step ? (options.node_min - base_node) / node_step : 0;
+
+		own = &slots[i < slot_count ? i : 0];
+		own->node = NODE;
+		own->pid = getpid();
+		first_salts = status.salt_count;
+
+		/* Fork children leave writing to their parent */
+		writer = john_main_process;
+#if HAVE_MPI
+		if (mpi_p > 1)
+			writer = 1;
+#endif
+		if (!writer) {
+			close(fd);
+			fd = -1;
+		}
+	}
+
+	emms();
+	if (status_get_progress)
+		progress = status_get_progress();
+
+	own->seq++;
+	own->done = done;
+	own->time = status_get_timef();
+	own->progress = progress;
+	own->guesses = status.guess_count;
+	own->passwords_left = status.password_count;
+	own->salts = first_salts;
+	own->salts_left = status.salt_count;
+	own->cands = status.cands;
+	own->crypts = status.crypts;
+	own->combs = status.combs_ehi * 18446744073709551616.0 + status.combs;
+	own->suppressed = status.suppressor_hit;
+	own->passed = status.suppressor_miss;
+	own->crypt_calls = crypt_calls;
+	own->crypt_keys = crypt_keys;
+	own->crypt_time = crypt_time;
+	own->crypt_max = crypt_max;
+	own->max_keys = max_keys;
+	own->last_keys = last_keys;
+	own->keys_queued = crk_keys_queued();
+	own->log_queued = log_queued();
+	own->seq++;
+}
+
+static void read_slot(struct metrics_slot *dst, struct metrics_slot *src)
+{
+	unsigned int seq;
+	int tries = 100;
+
+	do {
+		seq = src->seq;
+		memcpy(dst, src, sizeof(*dst));
+	} while ((seq & 1 || seq != src->seq) && --tries);
+}
+
+static double rate(double count, double time)
+{
+	return time > 0 ? count / time : 0;
+}
+
+static void write_record(int final)
+{
+	struct metrics_slot s, total;
+	char *p = record;
+	double dt, progress = 0;
+	int i, nodes = 0, progress_known = 1;
+
+	memset(&total, 0, sizeof(total));
+	p += sprintf(p, "{\"time\":%lu,\"final\":%s,\"nodes\":[",
+	             (unsigned long)time(NULL), final ? "true" : "false");
+
+	for (i = 0; i < slot_count; i++) {
+		read_slot(&s, &slots[i]);
+		if (!s.pid)
+			continue;
+
+		total.time = MAX(total.time, s.time);
+		total.guesses += s.guesses;
+		total.cands += s.cands;
+		total.crypts += s.crypts;
+		total.combs += s.combs;
+		total.suppressed += s.suppressed;
+		total.passed += s.passed;
+		total.crypt_calls += s.crypt_calls;
+		total.crypt_keys += s.crypt_keys;
+		total.crypt_time += s.crypt_time;
+		total.crypt_max = MAX(total.crypt_max, s.crypt_max);
+		total.max_keys = MAX(total.max_keys, s.max_keys);
+		total.last_keys += s.last_keys;
+		total.keys_queued += s.keys_queued;
+		total.log_queued += s.log_queued;
+		/*
+		 * Each node has its own copy of the database, which may lag behind
+		 * on others' cracks
+		 */
+		if (!nodes || s.passwords_left < total.passwords_left)
+			total.passwords_left = s.passwords_left;
+		if (!nodes || s.salts_left < total.salts_left)
+			total.salts_left = s.salts_left;
+		total.salts = s.salts;
+		if (s.progress < 0)
+			progress_known = 0;
+		else
+			progress += s.progress;
+
+		p += sprintf(p, "%s{\"node\":%u,\"pid\":%u,\"done\":%s,"
+		    "\"elapsed\":%.3f,\"progress\":%.4f,\"guesses\":%u,"
+		    "\"cands\":%"PRIu64",\"crypts\":%"PRIu64",\"combs\":%.0f,"
+		    "\"p_s\":%.3f,\"c_s\":%.3f,\"C_s\":%.3f,"
+		    "\"crypt_calls\":%"PRIu64",\"crypt_avg_ms\":%.3f,"
+		    "\"keys_queued\":%u,\"log_queued\":%u}",
+		    nodes++ ? "," : "", s.node, s.pid,
+		    s.done ? "true" : "false", s.time, s.progress,
+		    s.guesses, s.cands, s.crypts, s.combs,
+		    rate(s.cands, s.time), rate(s.crypts, s.time),
+		    rate(s.combs, s.time), s.crypt_calls,
+		    rate(1000 * s.crypt_time, s.crypt_calls),
+		    s.keys_queued, s.log_queued);
+	}
+
+	dt = total.time - prev_total.time;
+	sprintf(p, "],\"elapsed\":%.3f,\"progress\":%.4f,"
+	    "\"guesses\":%u,\"passwords_left\":%u,"
+	    "\"salts\":%u,\"salts_left\":%u,"
+	    "\"cands\":%"PRIu64",\"generated\":%"PRIu64
+	    ",\"suppressed\":%"PRIu64",\"crypts\":%"PRIu64",\"combs\":%.0f,"
+	    "\"g_s\":%.3f,\"p_s\":%.3f,\"c_s\":%.3f,\"C_s\":%.3f,"
+	    "\"interval\":{\"seconds\":%.3f,\"g_s\":%.3f,\"p_s\":%.3f,"
+	    "\"c_s\":%.3f,\"C_s\":%.3f},"
+	    "\"crypt_calls\":%"PRIu64",\"crypt_avg_ms\":%.3f,"
+	    "\"crypt_max_ms\":%.3f,\"batch_avg\":%.1f,\"batch_last\":%u,"
+	    "\"max_keys\":%u,\"keys_queued\":%u,\"log_queued\":%u}\n",
+	    total.time,
+	    progress_known && nodes ? progress / nodes : -1.0,
+	    total.guesses, total.passwords_left,
+	    total.salts, total.salts_left,
+	    total.cands, total.cands + total.suppressed,
+	    total.suppressed, total.crypts, total.combs,
+	    rate(total.guesses, total.time), rate(total.cands, total.time),
+	    rate(total.crypts, total.time), rate(total.combs, total.time),
+	    dt,
+	    rate(total.guesses - prev_total.guesses, dt),
+	    rate(total.cands - prev_total.cands, dt),
+	    rate(total.crypts - prev_total.crypts, dt),
+	    rate(total.combs - prev_total.combs, dt),
+	    total.crypt_calls, rate(1000 * total.crypt_time, total.crypt_calls),
+	    1000 * total.crypt_max,
+	    rate(total.crypt_keys, total.crypt_calls), total.last_keys,
+	    total.max_keys, total.keys_queued, total.log_queued);
+
+	prev_total = total;
+
+	/* One write per record, so concurrent MPI writers don't interleave */
+	if (write_loop(fd, record, strlen(record)) < 0)
+		pexit("write: %s", path_expand(options.metrics_file));
+}
+
+void metrics_update(void)
+{
+	event_metrics = 0;
+
+	if (!metrics_enabled)
+		return;
+
+	snapshot(0);
+
+	if (writer)
+		write_record(0);
+}
+
+void metrics_crypt_start(void)
+{
+	gettimeofday(&crypt_started, NULL);
+}
+
+void metrics_crypt_end(int count, int max)
+{
+	struct timeval now;
+	double t;
+
+	gettimeofday(&now, NULL);
+	t = seconds(&now) - seconds(&crypt_started);
+
+	crypt_calls++;
+	crypt_keys += count;
+	crypt_time += t;
+	if (t > crypt_max)
+		crypt_max = t;
+	last_keys = count;
+	max_keys = max;
+}
+
+void metrics_done(void)
+{
+	if (!metrics_enabled)
+		return;
+
+	snapshot(1);
+
+	if (writer)
+		write_record(1);
+	if (fd >= 0)
+		close(fd);
+	fd = -1;
+	MEM_FREE(record);
+
+	metrics_enabled = 0;
+}
@@ -0,0 +1,51 @@
+/*
+ * This file is part of John the Ripper password cracker.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted.
+ *
+ * There's ABSOLUTELY NO WARRANTY, express or implied.
+ */
+
+/*
+ * Machine-readable metrics stream (--metrics=FILE).
+ *
+ * Every MetricsInterval seconds, each process snapshots its counters into a
+ * slot of a shared page set up before forking.  The main process appends one
+ * JSON object per line to FILE, with totals over all of its --fork children
+ * and a per-node breakdown.  MPI processes don't share memory, so each of them
+ * writes its own lines.
+ */
+
+#ifndef _JOHN_METRICS_H
+#define _JOHN_METRICS_H
+
+/*
+ * Non-zero while metrics are being collected.
+ */
+extern int metrics_enabled;
+
+/*
+ * Sets up the shared slots.  Must be called before forking.  Does nothing
+ * unless --metrics was given.
+ */
+extern void metrics_init(void);
+
+/*
+ * Snapshots this process' counters and, if it is the writer, appends a
+ * record.  Called on event_metrics.
+ */
+extern void metrics_update(void);
+
+/*
+ * Brackets a call to crypt_all() for latency and batch size figures.
+ */
+extern void metrics_crypt_start(void);
+extern void metrics_crypt_end(int count, int max_keys);
+
+/*
+ * Writes the final record (after children are done) and closes the file.
+ */
+extern void metrics_done(void);
+
+#endif
@@ -776,6 +776,33 @@ int64_t host_avail_mem(void)
 	return avail_mem;
 }
 
+char *host_cpu_model(char *buffer, size_t size)
+{
+#if __linux__
+	FILE *fp;
+	char buf[LINE_BUFFER_SIZE], *p;
+#endif
+
+	strnzcpy(buffer, "unknown", size);
+
+#if __linux__
+	if ((fp = fopen("/proc/cpuinfo", "r"))) {
+		while (fgets(buf, LINE_BUFFER_SIZE, fp)) {
+			if (!strncmp(buf, "model name", 10) && (p = strchr(buf, ':'))) {
+				for (p++; *p == ' ' || *p == '\t'; p++)
+					;
+				strtok(p, "\r\n");
+				strnzcpy(buffer, p, size);
+				break;
+			}
+		}
+		fclose(fp);
+	}
+#endif
+
+	return buffer;
+}
+
 int parse_bool(char *string)
 {
 	if (string) {
@@ -241,6 +241,12 @@ extern int64_t host_total_mem(void);
  */
 extern int64_t host_avail_mem(void);
 
+/*
+ * Copy the CPU model name into buffer, or "unknown" if we can't tell.
+ * Returns buffer.
+ */
+extern char *host_cpu_model(char *buffer, size_t size);
+
 /*
  * Parse string for boolean. Case insensitive:
  * y/yes/true/1/OPT_TRISTATE_NO_PARAM: return 1
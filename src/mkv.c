@@ -7,8 +7,18 @@
 
 #include <stdio.h>
 #include <string.h>
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#if (!AC_BUILT || HAVE_UNISTD_H) && !_MSC_VER
+#include <unistd.h>
+#endif
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "arch.h"
+#include "mem_map.h"
 #include "misc.h"
 #include "params.h"
 #include "path.h"
@@ -29,12 +39,26 @@
 #include "mkv.h"
 #include "mask.h"
 #include "regex.h"
+#include "md5.h"
 
 #define SUBSECTION_DEFAULT  "Default"
 
 extern struct fmt_main fmt_LM;
 
+/*
+ * Candidates per thread and block, and the space for each in the buffer
+ */
+#define MKV_CHUNK			0x1000
+#define MKV_KEY_SIZE			(MAX_MKV_LEN + 1)
+
 static int64_t tidx, hybrid_tidx;
+static int mkv_threads;
+#ifdef HAVE_MMAP
+static void *mkv_cache_map;
+static size_t mkv_cache_len;
+#endif
+static char mkv_cache_name[PATH_BUFFER_SIZE];
+static const char *mkv_cache_note;
 #if HAVE_REXGEN
 static char *regex_alpha;
 static int regex_case;
@@ -68,259 +92,123 @@ void mkv_hybrid_fix_state(void)
 	hybrid_tidx = gidx;
 }
 
-static int show_pwd_rnbs(struct db_main *db, struct s_pwd *pwd)
+/*
+ * Tries one candidate, the same way for every cracking mode we can be
+ * stacked with.
+ */
+static int mkv_process_key(struct db_main *db, char *word)
 {
-	uint64_t i;
-	unsigned int k;
-	unsigned long lvl;
 	char pass_filtered[PLAINTEXT_BUFFER_SIZE];
-	char *pass;
-
-	k = 0;
-	i = nbparts[pwd->password[pwd->len - 1] + pwd->len * 256 +
-	            pwd->level * 256 * gmax_len];
-	pwd->len++;
-	lvl = pwd->level;
-	pwd->password[pwd->len] = 0;
-	while (i > 1) {
-		pwd->password[pwd->len - 1] =
-		    charsorted[pwd->password[pwd->len - 2] * 256 + k];
-		pwd->level =
-		    lvl + proba2[pwd->password[pwd->len - 2] * 256 +
-		                 pwd->password[pwd->len - 1]];
-		i -= nbparts[pwd->password[pwd->len - 1] + pwd->len * 256 +
-		             pwd->level * 256 * gmax_len];
-		if (pwd->len <= gmax_len) {
-			if (show_pwd_rnbs(db, pwd))
-				return 1;
-		}
-		if ((pwd->len >= gmin_len) && (pwd->level >= gmin_level)) {
-			pass = (char *)pwd->password;
+	char *pass = word;
+
 #if HAVE_REXGEN
-			if (regex) {
-				if (do_regex_hybrid_crack(db, regex, pass,
-				                          regex_case, regex_alpha))
-					return 1;
-				mkv_hybrid_fix_state();
-			} else
+	if (regex) {
+		if (do_regex_hybrid_crack(db, regex, pass,
+		                          regex_case, regex_alpha))
+			return 1;
+		mkv_hybrid_fix_state();
+	} else
 #endif
-			if (f_new) {
-				if (do_external_hybrid_crack(db, pass))
-					return 1;
-				mkv_hybrid_fix_state();
-			} else
-			if (options.flags & FLG_MASK_CHK) {
-				if (do_mask_crack(pass))
-					return 1;
-			} else
-			if (!f_filter ||
-			    ext_filter_body((char *)pwd->password, pass = pass_filtered))
-				if (crk_process_key(pass))
-					return 1;
-		}
-		gidx++;
-		k++;
-		if (gidx > gend)
+	if (f_new) {
+		if (do_external_hybrid_crack(db, pass))
 			return 1;
-	}
-	pwd->len--;
-	pwd->password[pwd->len] = 0;
-	pwd->level = lvl;
+		mkv_hybrid_fix_state();
+	} else
+	if (options.flags & FLG_MASK_CHK) {
+		if (do_mask_crack(pass))
+			return 1;
+	} else
+	if (!f_filter || ext_filter_body(word, pass = pass_filtered))
+		if (crk_process_key(pass))
+			return 1;
+
 	return 0;
 }
 
-static int show_pwd_r(struct db_main *db, struct s_pwd *pwd, unsigned int bs)
+/*
+ * Writes the candidates with index in [start, end) that are within the min.
+ * length and level to keys, along with their indices.  Returns the number of
+ * candidates written.  This only reads globals, so threads can run it on
+ * disjoint ranges at once.
+ */
+static int mkv_gen_keys(uint64_t start, uint64_t end,
+                        char *keys, uint64_t *ranks)
 {
-	uint64_t i;
-	unsigned int k;
-	unsigned long lvl;
-	unsigned char curchar;
-	char pass_filtered[PLAINTEXT_BUFFER_SIZE];
-	char *pass;
-
-	k = 0;
-	i = nbparts[pwd->password[pwd->len - 1] + pwd->len * 256 +
-	            pwd->level * 256 * gmax_len];
-	pwd->len++;
-	lvl = pwd->level;
-	if (bs) {
-		while ((curchar =
-		            charsorted[pwd->password[pwd->len - 2] * 256 + k]) !=
-		        pwd->password[pwd->len - 1]) {
-			i -= nbparts[curchar + pwd->len * 256 + (pwd->level +
-			             proba2[pwd->password[pwd->len - 2] * 256 +
-			                    curchar]) * 256 * gmax_len];
-			k++;
-		}
-		pwd->level +=
-		    proba2[pwd->password[pwd->len - 2] * 256 + pwd->password[pwd->len -
-		            1]];
-		if (pwd->password[pwd->len] != 0)
-			if (show_pwd_r(db, pwd, 1))
-				return 1;
-		i -= nbparts[pwd->password[pwd->len - 1] + pwd->len * 256 +
-		             pwd->level * 256 * gmax_len];
-		if ((pwd->len >= gmin_len) && (pwd->level >= gmin_level)) {
-			pass = (char *)pwd->password;
-#if HAVE_REXGEN
-			if (regex) {
-				if (do_regex_hybrid_crack(db, regex, pass,
-				                          regex_case, regex_alpha))
-					return 1;
-				mkv_hybrid_fix_state();
-			} else
-#endif
-			if (f_new) {
-				if (do_external_hybrid_crack(db, pass))
-					return 1;
-				mkv_hybrid_fix_state();
-			} else
-			if (options.flags & FLG_MASK_CHK) {
-				if (do_mask_crack(pass))
-					return 1;
-			} else
-			if (!f_filter ||
-			    ext_filter_body((char *)pwd->password, pass = pass_filtered))
-				if (crk_process_key(pass))
-					return 1;
-		}
-		gidx++;
-		k++;
-	}
-	pwd->password[pwd->len] = 0;
-	while (i > 1) {
-		pwd->password[pwd->len - 1] =
-		    charsorted[pwd->password[pwd->len - 2] * 256 + k];
-		pwd->level =
-		    lvl + proba2[pwd->password[pwd->len - 2] * 256 +
-		                 pwd->password[pwd->len - 1]];
-		i -= nbparts[pwd->password[pwd->len - 1] + pwd->len * 256 +
-		             pwd->level * 256 * gmax_len];
-		if (pwd->len <= gmax_len) {
-			if (show_pwd_r(db, pwd, 0))
-				return 1;
-		}
-		if ((pwd->len >= gmin_len) && (pwd->level >= gmin_level)) {
-			pass = (char *)pwd->password;
-#if HAVE_REXGEN
-			if (regex) {
-				if (do_regex_hybrid_crack(db, regex, pass,
-				                          regex_case, regex_alpha))
-					return 1;
-				mkv_hybrid_fix_state();
-			} else
-#endif
-			if (f_new) {
-				if (do_external_hybrid_crack(db, pass))
-					return 1;
-				mkv_hybrid_fix_state();
-			} else
-			if (options.flags & FLG_MASK_CHK) {
-				if (do_mask_crack(pass))
-					return 1;
-			} else
-			if (!f_filter ||
-			    ext_filter_body((char *)pwd->password, pass = pass_filtered))
-				if (crk_process_key(pass))
-					return 1;
+	struct mkv_iter it;
+	int count = 0;
+
+	if (start >= end || mkv_iter_seek(&it, start))
+		return 0;
+
+	do {
+		if (it.len >= gmin_len && it.level[it.len - 1] >= gmin_level) {
+			memcpy(keys, it.password, it.len + 1);
+			keys += MKV_KEY_SIZE;
+			ranks[count++] = it.idx;
 		}
-		gidx++;
-		k++;
-		if (gidx > gend)
-			return 1;
-	}
-	pwd->len--;
-	pwd->password[pwd->len] = 0;
-	pwd->level = lvl;
-	return 0;
+	} while (it.idx + 1 < end && !mkv_iter_next(&it));
+
+	return count;
 }
 
-static int show_pwd(struct db_main *db, uint64_t start)
+/*
+ * Runs the candidates with index in [gidx, gend) in blocks.  Each thread
+ * generates a separate, consecutive part of a block and the candidates are
+ * then tried in order, so the outcome doesn't depend on the thread count.
+ */
+static void mkv_crack(struct db_main *db)
 {
-	struct s_pwd pwd;
-	unsigned int i;
-	char pass_filtered[PLAINTEXT_BUFFER_SIZE];
-	char *pass;
-
-	if (gidx == 0)
-		gidx = start;
-	i = 0;
-
-	if (gidx > 0) {
-		print_pwd(gidx, &pwd, gmax_level, gmax_len);
-		while (charsorted[i] != pwd.password[0])
-			i++;
-		pwd.len = 1;
-		pwd.level = proba1[pwd.password[0]];
-		if (pwd.level <= gmax_level) {
-			if (show_pwd_r(db, &pwd, 1))
-				return 1;
-
-			if ((pwd.len >= gmin_len) && (pwd.level >= gmin_level)) {
-				pass = (char *)pwd.password;
-#if HAVE_REXGEN
-				if (regex) {
-					if (do_regex_hybrid_crack(db, regex, pass,
-					                          regex_case, regex_alpha))
-						return 1;
-					mkv_hybrid_fix_state();
-				} else
+	char *keys;
+	uint64_t *ranks;
+	int *counts;
+
+	keys = mem_alloc((size_t)mkv_threads * MKV_CHUNK * MKV_KEY_SIZE);
+	ranks = mem_alloc((size_t)mkv_threads * MKV_CHUNK * sizeof(*ranks));
+	counts = mem_alloc(mkv_threads * sizeof(*counts));
+
+	while (gidx < gend) {
+		uint64_t base = gidx;
+		int t;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(mkv_threads)
 #endif
-				if (f_new) {
-					if (do_external_hybrid_crack(db, pass))
-						return 1;
-					mkv_hybrid_fix_state();
-				} else
-				if (options.flags & FLG_MASK_CHK) {
-					if (do_mask_crack(pass))
-						return 1;
-				} else
-				if (!f_filter ||
-				    ext_filter_body((char *)pwd.password, pass = pass_filtered))
-					if (crk_process_key(pass))
-						return 1;
-			}
+		for (t = 0; t < mkv_threads; t++) {
+			uint64_t start = base + (uint64_t)t * MKV_CHUNK;
+			uint64_t end = start + MKV_CHUNK;
+
+			if (start > gend)
+				start = gend;
+			if (end > gend)
+				end = gend;
+
+			counts[t] = mkv_gen_keys(start, end,
+			    keys + (size_t)t * MKV_CHUNK * MKV_KEY_SIZE,
+			    ranks + (size_t)t * MKV_CHUNK);
 		}
-		gidx++;
-		i++;
-	}
-	while (proba1[charsorted[i]] <= gmax_level) {
-		if (gidx > gend)
-			return 1;
-		pwd.len = 1;
-		pwd.password[0] = charsorted[i];
-		pwd.level = proba1[pwd.password[0]];
-		pwd.password[1] = 0;
-		if (show_pwd_rnbs(db, &pwd))
-			return 1;
-		if ((pwd.len >= gmin_len) && (pwd.level >= gmin_level)) {
-			pass = (char *)pwd.password;
-#if HAVE_REXGEN
-			if (regex) {
-				if (do_regex_hybrid_crack(db, regex, pass,
-				                          regex_case, regex_alpha))
-					return 1;
-				mkv_hybrid_fix_state();
-			} else
-#endif
-			if (f_new) {
-				if (do_external_hybrid_crack(db, pass))
-					return 1;
-				mkv_hybrid_fix_state();
-			} else
-			if (options.flags & FLG_MASK_CHK) {
-				if (do_mask_crack(pass))
-					return 1;
-			} else
-			if (!f_filter ||
-			    ext_filter_body((char *)pwd.password, pass = pass_filtered))
-				if (crk_process_key(pass))
-					return 1;
+
+		for (t = 0; t < mkv_threads; t++) {
+			char *key = keys + (size_t)t * MKV_CHUNK * MKV_KEY_SIZE;
+			uint64_t *rank = ranks + (size_t)t * MKV_CHUNK;
+			int i;
+
+			for (i = 0; i < counts[t]; i++, key += MKV_KEY_SIZE) {
+				gidx = rank[i];
+				if (mkv_process_key(db, key))
+					goto out;
+			}
 		}
-		gidx++;
-		i++;
+
+		if (gend - base > (uint64_t)mkv_threads * MKV_CHUNK)
+			gidx = base + (uint64_t)mkv_threads * MKV_CHUNK;
+		else
+			gidx = gend;
 	}
-	return 0;
+
+out:
+	MEM_FREE(counts);
+	MEM_FREE(ranks);
+	MEM_FREE(keys);
 }
 
 static double get_progress(void)
@@ -645,6 +533,157 @@ void get_markov_start_end(char *start_token, char *end_token,
 	}
 }
 
+/*
+ * The nbparts[] table only depends on the stats file contents, the level
+ * and the length, yet it is slow to compute and large for the higher levels.
+ * We keep a copy of it on disk and map it read-only on later runs, so that
+ * all processes of a --fork or --node session share the same pages.
+ */
+#define MKV_CACHE_MAGIC			"JtRMkvN1"
+#define MKV_CACHE_ENDIAN		0x01020304
+
+struct mkv_cache_header {
+	char magic[8];
+	uint32_t endian, level, maxlen, pad;
+	unsigned char stats[16];
+	uint64_t size;
+};
+
+static int mkv_cache_load(const char *name,
+                          const struct mkv_cache_header *want)
+{
+	struct mkv_cache_header hdr;
+	struct stat st;
+	size_t len = sizeof(hdr) + want->size;
+	FILE *file;
+
+	if (!(file = fopen(name, "rb")))
+		return 1;
+
+	if (fread(&hdr, sizeof(hdr), 1, file) != 1 ||
+	    memcmp(&hdr, want, sizeof(hdr)) ||
+	    fstat(fileno(file), &st) || (size_t)st.st_size != len) {
+		fclose(file);
+		return 1;
+	}
+
+#ifdef HAVE_MMAP
+	mkv_cache_map = mmap(NULL, len, PROT_READ, MAP_SHARED, fileno(file), 0);
+	fclose(file);
+	if (mkv_cache_map == MAP_FAILED) {
+		mkv_cache_map = NULL;
+		return 1;
+	}
+	mkv_cache_len = len;
+	nbparts = (uint64_t*)((char*)mkv_cache_map + sizeof(hdr));
+#else
+	nbparts = mem_alloc(want->size);
+	if (fread(nbparts, want->size, 1, file) != 1) {
+		fclose(file);
+		MEM_FREE(nbparts);
+		return 1;
+	}
+	fclose(file);
+#endif
+
+	return 0;
+}
+
+static void mkv_cache_save(const char *name,
+                           const struct mkv_cache_header *hdr)
+{
+	char tmp[PATH_BUFFER_SIZE + 16];
+	FILE *file;
+	int failed;
+
+	/* Write to a private name and rename, so readers never see a partial file */
+	snprintf(tmp, sizeof(tmp), "%s.%u", name, (unsigned int)getpid());
+	if (!(file = fopen(tmp, "wb"))) {
+		log_event("! Can't create Markov cache %s: %s", tmp, strerror(errno));
+		return;
+	}
+
+	failed = fwrite(hdr, sizeof(*hdr), 1, file) != 1 ||
+		fwrite(nbparts, hdr->size, 1, file) != 1;
+	if (fclose(file))
+		failed = 1;
+
+	if (failed || rename(tmp, name)) {
+		log_event("! Can't write Markov cache %s: %s", name, strerror(errno));
+		unlink(tmp);
+	} else
+		mkv_cache_note = "Saved Markov tables to";
+}
+
+static void mkv_init_nbparts(unsigned int level, unsigned int maxlen)
+{
+	struct mkv_cache_header hdr;
+	char file[PATH_BUFFER_SIZE], *name = mkv_cache_name;
+	const char *param;
+	MD5_CTX ctx;
+
+	memset(&hdr, 0, sizeof(hdr));
+	memcpy(hdr.magic, MKV_CACHE_MAGIC, sizeof(hdr.magic));
+	hdr.endian = MKV_CACHE_ENDIAN;
+	hdr.level = level;
+	hdr.maxlen = maxlen;
+	hdr.size = 256 * (level + 1) * (maxlen + 1) * sizeof(uint64_t);
+
+	*name = 0;
+	if (!(param = cfg_get_param(SECTION_OPTIONS, NULL, "MarkovCacheDir")))
+		param = MKV_CACHE_DIR;
+	if (*param) {
+		char stats[2 * sizeof(hdr.stats) + 1];
+		int i, len;
+
+		MD5_Init(&ctx);
+		MD5_Update(&ctx, first, 256);
+		MD5_Update(&ctx, proba1, 256);
+		MD5_Update(&ctx, proba2, 256 * 256);
+		MD5_Final(hdr.stats, &ctx);
+
+		for (i = 0; i < (int)sizeof(hdr.stats); i++)
+			sprintf(&stats[2 * i], "%02x", hdr.stats[i]);
+		len = snprintf(file, sizeof(file), "%s/markov-%s-%u-%u.nbp",
+		               param, stats, level, maxlen);
+
+		if (len < 0 || len >= (int)sizeof(file) ||
+		    strlen(path_expand(file)) >= sizeof(mkv_cache_name)) {
+			if (john_main_process)
+				log_event("! MarkovCacheDir path too long, "
+				          "not caching Markov tables");
+		} else {
+			strcpy(name, path_expand(file));
+
+			if (!mkv_cache_load(name, &hdr)) {
+				mkv_cache_note =
+					"Using cached Markov tables from";
+				return;
+			}
+		}
+	}
+
+	nbparts = mem_calloc(1, hdr.size);
+	nb_parts(0, 0, 0, level, maxlen);
+
+	/* Only one process writes the cache, the others computed their own */
+	if (*name && john_main_process)
+		mkv_cache_save(name, &hdr);
+}
+
+static void mkv_done_nbparts(void)
+{
+#ifdef HAVE_MMAP
+	if (mkv_cache_map) {
+		munmap(mkv_cache_map, mkv_cache_len);
+		mkv_cache_map = NULL;
+		nbparts = NULL;
+		return;
+	}
+#endif
+	MEM_FREE(nbparts);
+}
+
 void do_markov_crack(struct db_main *db, char *mkv_param)
 {
 	char *statfile = NULL;
@@ -688,13 +727,7 @@ void do_markov_crack(struct db_main *db, char *mkv_param)
 	gmin_level = mkv_minlevel;
 	gmin_len = mkv_minlen;
 
-	nbparts =
-	    mem_alloc(256 * (mkv_level + 1) * sizeof(int64_t) * (mkv_maxlen +
-	              1));
-	memset(nbparts, 0,
-	       256 * (mkv_level + 1) * (mkv_maxlen + 1) * sizeof(int64_t));
-
-	nb_parts(0, 0, 0, mkv_level, mkv_maxlen);
+	mkv_init_nbparts(mkv_level, mkv_maxlen);
 
 	get_markov_start_end(start_token, end_token, nbparts[0], &mkv_start,
 	                     &mkv_end);
@@ -710,19 +743,34 @@ void do_markov_crack(struct db_main *db, char *mkv_param)
 		        options.node_count > 1 ? " split over nodes" : "");
 	}
 
+	/*
+	 * From here on, mkv_end is exclusive.  The root of the tree is counted
+	 * in nbparts[0], but is not a candidate.
+	 */
+	if (++mkv_end > nbparts[0] - 1)
+		mkv_end = nbparts[0] - 1;
+
 	if (options.node_count > 1) {
-		uint64_t mkv_size;
-
-		mkv_size = mkv_end - mkv_start + 1;
-		if (options.node_max != options.node_count)
-			mkv_end =
-			    mkv_start + mkv_size / options.node_count * options.node_max -
-			    1;
-		mkv_start += mkv_size / options.node_count * (options.node_min - 1);
+		uint64_t mkv_size = mkv_end - mkv_start;
+		uint64_t q = mkv_size / options.node_count;
+		uint64_t r = mkv_size % options.node_count;
+
+		mkv_end = mkv_start + q * options.node_max +
+			r * options.node_max / options.node_count;
+		mkv_start += q * (options.node_min - 1) +
+			r * (options.node_min - 1) / options.node_count;
 	}
 
 	gstart = mkv_start;
-	gend = mkv_end + 10;        /* omg !! */
+	gend = mkv_end;
+
+#ifdef _OPENMP
+	if ((mkv_threads = cfg_get_int(SECTION_OPTIONS, NULL,
+	                               "MarkovThreads")) <= 0)
+		mkv_threads = omp_get_max_threads();
+#else
+	mkv_threads = 1;
+#endif
 
 	log_event("Proceeding with Markov mode%s%s",
 	          param ? " " : "", param ? param : "");
@@ -730,6 +778,8 @@ void do_markov_crack(struct db_main *db, char *mkv_param)
 	log_event("- Markov level: %d - %d", mkv_minlevel, mkv_level);
 	log_event("- Length: %d - %d", mkv_minlen, mkv_maxlen);
 	log_event("- Start-End: %" PRIu64 " - %" PRIu64, mkv_start, mkv_end);
+	if (mkv_cache_note)
+		log_event("- %s %s", mkv_cache_note, mkv_cache_name);
 
 	if (rec_restored && john_main_process) {
 		fprintf(stderr, "Proceeding with Markov%s%s",
@@ -746,7 +796,13 @@ void do_markov_crack(struct db_main *db, char *mkv_param)
 		fprintf(stderr, "\n");
 	}
 
-	show_pwd(db, mkv_start);
+	if (gidx < gstart || gidx > gend)
+		gidx = gstart;
+
+	if (mkv_threads > 1)
+		log_event("- Generating candidates using %d threads", mkv_threads);
+
+	mkv_crack(db);
 
 	if (!event_abort)
 		gidx = gend;            // For reporting DONE properly
@@ -754,7 +810,7 @@ void do_markov_crack(struct db_main *db, char *mkv_param)
 	crk_done();
 	rec_done(event_abort);
 
-	MEM_FREE(nbparts);
+	mkv_done_nbparts();
 	MEM_FREE(proba1);
 	MEM_FREE(proba2);
 	MEM_FREE(first);
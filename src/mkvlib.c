@@ -111,6 +111,105 @@ void print_pwd(uint64_t index, struct s_pwd *pwd,
 }
 
 
+#define NBPARTS(c, len, level) \
+	nbparts[(c) + (len) * 256 + (level) * 256 * gmax_len]
+
+/*
+ * Finds the first child, at or after index k in its charsorted[] row, of the
+ * password's first pos characters and stores it at position pos.  Returns
+ * the index, or 256 if there's no such child within gmax_level.
+ */
+static unsigned int mkv_child(struct mkv_iter *it, unsigned int pos,
+                              unsigned int k)
+{
+	unsigned int row = pos ? it->password[pos - 1] : 0;
+
+	for (; k < 256; k++) {
+		unsigned char c = charsorted[row * 256 + k];
+		unsigned int level;
+
+		/* nb_parts() never counts NUL */
+		if (!c)
+			continue;
+
+		if (pos)
+			level = it->level[pos - 1] + proba2[row * 256 + c];
+		else
+			level = proba1[c];
+
+		/* Rows are sorted by probability, so no more children */
+		if (level > gmax_level)
+			break;
+
+		it->password[pos] = c;
+		it->level[pos] = level;
+		it->k[pos] = k;
+		return k;
+	}
+
+	return 256;
+}
+
+int mkv_iter_seek(struct mkv_iter *it, uint64_t index)
+{
+	unsigned int pos = 0, k = 0;
+
+	if (index >= nbparts[0] - 1)
+		return 1;
+
+	it->idx = index;
+
+	/*
+	 * Walk down from the root, skipping whole subtrees before the one
+	 * holding our index.  Within a subtree, the password at its top is
+	 * last.
+	 */
+	while ((k = mkv_child(it, pos, k)) < 256) {
+		uint64_t size = NBPARTS(it->password[pos], pos + 1,
+		                        it->level[pos]);
+
+		if (index < size) {
+			it->len = ++pos;
+			if (index == size - 1) {
+				it->password[pos] = 0;
+				return 0;
+			}
+			k = 0;
+		} else {
+			index -= size;
+			k++;
+		}
+	}
+
+	return 1;
+}
+
+int mkv_iter_next(struct mkv_iter *it)
+{
+	unsigned int pos = it->len - 1;
+
+	it->idx++;
+
+	if (mkv_child(it, pos, it->k[pos] + 1) == 256) {
+		/* Subtree done, its top is next - unless that's the root */
+		if (!pos)
+			return 1;
+		it->len = pos;
+		it->password[pos] = 0;
+		return 0;
+	}
+
+	/* Go down to the first password under the next sibling */
+	pos++;
+	while (pos < gmax_len && mkv_child(it, pos, 0) < 256)
+		pos++;
+	it->len = pos;
+	it->password[pos] = 0;
+
+	return 0;
+}
+
+
 static void stupidsort(unsigned char *result, unsigned char *source,
                        unsigned int size)
 {
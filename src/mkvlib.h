@@ -23,6 +23,20 @@ extern uint64_t *nbparts;
 extern unsigned char *first;
 extern unsigned char charsorted[256 * 256];
 
+/*
+ * Iterator over the Markov keyspace, which is the tree of all passwords within
+ * the level and length limits, walked in post-order: a password comes right
+ * after all passwords it is a prefix of.  idx is the current password's index
+ * in that walk, the same index nb_parts() counts and mkv_start/mkv_end use.
+ */
+struct mkv_iter {
+	uint64_t idx;
+	unsigned int len;
+	unsigned int level[MAX_MKV_LEN];
+	unsigned char k[MAX_MKV_LEN];
+	unsigned char password[MAX_MKV_LEN + 1];
+};
+
 extern unsigned int gmax_level;
 extern unsigned int gmax_len;
 extern unsigned int gmin_level;
@@ -36,4 +50,12 @@ void print_pwd(uint64_t index, struct s_pwd *pwd,
 uint64_t nb_parts(unsigned char lettre, unsigned int len,
                             unsigned int level, unsigned int max_lvl, unsigned int max_len);
 void init_probatables(const char *filename);
+
+/*
+ * Position the iterator at the given index (using the nbparts[] tables
+ * filled in by nb_parts()), or step to the next password.  Both return
+ * non-zero when past the end of the keyspace.
+ */
+int mkv_iter_seek(struct mkv_iter *it, uint64_t index);
+int mkv_iter_next(struct mkv_iter *it);
 #endif
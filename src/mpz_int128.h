@@ -195,6 +195,7 @@ extern double __ntod(__uint128_t);
 #endif // __MIC__
 #define mpf_sgn(F) ((F) < (double)0.0 ? -1 : (F) > (double)0.0)
 #define mpf_div(q, n, d) q = n / d
+#define mpf_div_ui(q, n, d) q = n / (d)
 #define mpf_clear(x) x = 0
 #define mpf_get_d(x) x
 #define mpf_mul_ui(rop, op1, op2) rop = op1 * (op2)
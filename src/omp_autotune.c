@@ -5,6 +5,17 @@
  * modifications, are permitted.
  */
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#if (!AC_BUILT || HAVE_UNISTD_H) && !_MSC_VER
+#include <unistd.h>
+#endif
+#ifdef _MSC_VER
+#include <io.h>
+#include <process.h>
+#endif
 #ifdef _OPENMP
 #include <omp.h>
 #endif
@@ -15,6 +26,16 @@
 #include "formats.h"
 #include "timer.h"
 #include "config.h"
+#include "misc.h"
+#include "params.h"
+#include "path.h"
+#include "version.h"
+
+#ifdef NO_JOHN_BLD
+#define JOHN_BLD "unk-build-type"
+#else
+#include "john_build_rule.h"
+#endif
 
 #define CONF_SECTION SECTION_OPTIONS, ":CPUtune"
 
@@ -29,6 +50,9 @@ static int report;
 static int fmt_preset;
 static int tune_preset;
 static int scale = 1;
+static int last_scale = 1;
+static int use_cache, force_tune;
+static int use_workload;
 
 void omp_autotune_init(void)
 {
@@ -53,12 +77,19 @@ void omp_autotune_init(void)
 	     cfg_get_int(CONF_SECTION, "AutoTuneMaxNoProgress")) < 0)
 		max_no_progress = 3;
 
+	use_cache = cfg_get_bool(CONF_SECTION, "AutoTuneCache", 1);
+	use_workload = cfg_get_bool(CONF_SECTION, "AutoTuneWorkload", 1);
+
 	if (options.tune) {
 		if (!strcmp(options.tune, "auto"))
 			use_preset = 0;
-		else if (!strcmp(options.tune, "report")) {
+		else if (!strcmp(options.tune, "force")) {
+			use_preset = 0;
+			force_tune = 1;
+		} else if (!strcmp(options.tune, "report")) {
 			use_preset = 0;
 			report = 1;
+			use_cache = 0;
 		} else {
 			use_preset = 1;
 			tune_preset = atoi(options.tune);
@@ -83,6 +114,8 @@ int omp_autotune(struct fmt_main *format, int preset)
 	if (omp_autotune_running)
 		return threads * scale;
 
+	last_scale = ret_scale;
+
 	if (!use_preset || !preset) {
 		fmt = format;
 		mkpc = format->params.max_keys_per_crypt;
@@ -93,6 +126,204 @@ int omp_autotune(struct fmt_main *format, int preset)
 	return threads * ret_scale;
 }
 
+/*
+ * Cached results are lines of "scale<TAB>key", where the key is made of the
+ * format label, thread count, tunable cost, what db we tuned with, build and
+ * CPU model.  There's one line per key, rewritten in place when re-tuning.
+ */
+static char *autotune_cache_key(char *buffer, size_t size, int threads,
+                                int cost, int salts)
+{
+	char cpu[LINE_BUFFER_SIZE], tuned_on[32] = "test";
+	int bucket = 1;
+
+	/* Results over real salts are kept per power of two of their count */
+	if (salts) {
+		while (bucket <= salts / 2)
+			bucket *= 2;
+		snprintf(tuned_on, sizeof(tuned_on), "salts %d", bucket);
+	}
+
+	snprintf(buffer, size, "%s\t%d\t%d\t%s\t%s %s\t%s",
+	         fmt->params.label, threads, cost, tuned_on, JTR_GIT_VERSION,
+	         JOHN_BLD, host_cpu_model(cpu, sizeof(cpu)));
+
+	return buffer;
+}
+
+static int autotune_cache_get(const char *key)
+{
+	FILE *file;
+	char line[LINE_BUFFER_SIZE], *p;
+	int found = 0;
+
+	if (!(file = fopen(path_expand(TUNE_CACHE_NAME), "r")))
+		return 0;
+
+	while (fgets(line, sizeof(line), file)) {
+		strtok(line, "\r\n");
+		if ((p = strchr(line, '\t')) && !strcmp(p + 1, key)) {
+			found = atoi(line);
+			break;
+		}
+	}
+
+	fclose(file);
+
+	return found > 0 ? found : 0;
+}
+
+static void autotune_cache_put(const char *key, int value)
+{
+	char name[PATH_BUFFER_SIZE], tmp[PATH_BUFFER_SIZE + 16];
+	char line[LINE_BUFFER_SIZE], *p;
+	FILE *in, *out;
+	int failed;
+
+	if (!john_main_process)
+		return;
+
+	/* Copy all other entries to a private name and rename that over */
+	strnzcpy(name, path_expand(TUNE_CACHE_NAME), sizeof(name));
+	snprintf(tmp, sizeof(tmp), "%s.%u", name, (unsigned int)getpid());
+	if (!(out = fopen(tmp, "w"))) {
+		log_event("Can't update autotune cache %s: %s", tmp,
+		          strerror(errno));
+		return;
+	}
+
+	if ((in = fopen(name, "r"))) {
+		while (fgets(line, sizeof(line), in)) {
+			/* Drop blank lines, strtok() would leave their newline */
+			if (!strtok(line, "\r\n"))
+				continue;
+			if (!(p = strchr(line, '\t')) || strcmp(p + 1, key))
+				fprintf(out, "%s\n", line);
+		}
+		fclose(in);
+	}
+
+	fprintf(out, "%d\t%s\n", value, key);
+	failed = ferror(out);
+	if (fclose(out))
+		failed = 1;
+
+	if (failed || rename(tmp, name)) {
+		log_event("Can't update autotune cache %s: %s", name,
+		          strerror(errno));
+		unlink(tmp);
+	}
+}
+
+/*
+ * Sets up the format's buffers for the current scale.
+ */
+static void autotune_setup(int threads)
+{
+	if (threads == 1)
+		fmt->params.max_keys_per_crypt =
+			fmt->params.min_keys_per_crypt * scale; // We're tuning MKPC
+	else
+		fmt->params.max_keys_per_crypt = mkpc * threads * scale;
+
+	// Release old buffers
+	fmt->methods.done();
+
+	// Set up buffers for this scale
+	fmt->methods.init(fmt);
+}
+
+static void autotune_set_keys(int kpc)
+{
+	char key[PLAINTEXT_BUFFER_SIZE] = "tUne0000";
+	int i;
+
+	fmt->methods.clear_keys();
+	for (i = 0; i < kpc; i++) {
+		key[4] = '0' + (i / 1000) % 10;
+		key[5] = '0' + (i / 100) % 10;
+		key[6] = '0' + (i / 10) % 10;
+		key[7] = '0' + i % 10;
+		fmt->methods.set_key(key, i);
+	}
+}
+
+/*
+ * What crk_password_loop() does with the crypt_all() results when nothing
+ * cracks: bitmap lookups, or cmp_all() against each hash for small salts.
+ */
+static void autotune_lookup(struct db_salt *salt, int match)
+{
+	struct db_password *pw;
+	int index;
+
+	if (!match || !(pw = salt->list))
+		return;
+
+	if (!salt->bitmap) {
+		do {
+			if (fmt->methods.cmp_all(pw->binary, match))
+			for (index = 0; index < match; index++)
+				fmt->methods.cmp_one(pw->binary, index);
+		} while ((pw = pw->next));
+		return;
+	}
+
+	for (index = 0; index < match; index++) {
+		unsigned int hash = salt->index(index);
+
+		if (salt->bitmap[hash / (sizeof(*salt->bitmap) * 8)] &
+		    (1U << (hash % (sizeof(*salt->bitmap) * 8))))
+			for (pw = salt->hash[hash >> PASSWORD_HASH_SHR]; pw;
+			     pw = pw->next_hash)
+				fmt->methods.cmp_one(pw->binary, index);
+	}
+}
+
+/*
+ * Times batches the way the cracker runs them against a real db: the keys
+ * are set, then each loaded salt in turn is set, crypted and looked up.
+ * Once the sample time is up we may be part way through the salts, so only
+ * that share of the key setting time is counted.  Returns the crypts, each
+ * salt's counted, and their duration in seconds.
+ */
+static int autotune_workload(struct db_main *db, int kpc, int min_crypts,
+                             double *duration)
+{
+	struct db_salt *salt = NULL;
+	uint64_t start, end, keys_time = 0, loop_time = 0;
+	int crypts = 0, key_sets = 0, salts = 0;
+
+	do {
+		int count = kpc;
+		int match;
+
+		if (!salt) {
+			start = john_get_nano();
+			autotune_set_keys(kpc);
+			keys_time += john_get_nano() - start;
+			key_sets++;
+			salt = db->salts;
+		}
+
+		start = john_get_nano();
+		fmt->methods.set_salt(salt->salt);
+		match = fmt->methods.crypt_all(&count, salt);
+		autotune_lookup(salt, match);
+		end = john_get_nano();
+
+		loop_time += end - start;
+		crypts += count;
+		salts++;
+		salt = salt->next;
+	} while (crypts < min_crypts || loop_time < sample_time);
+
+	*duration = (loop_time + (double)keys_time / key_sets * salts /
+	             db->salt_count) / 1E9;
+
+	return crypts;
+}
+
 void omp_autotune_run(struct db_main *db)
 {
 #ifdef _OPENMP
@@ -106,8 +337,9 @@ void omp_autotune_run(struct db_main *db)
 	int no_progress = 0;
 	int min_crypts = 0;
 	int tune_cost;
+	struct db_main *workload;
 	void *salt;
-	char key[PLAINTEXT_BUFFER_SIZE] = "tUne0000";
+	char cache_key[2 * LINE_BUFFER_SIZE];
 	uint64_t start, end;
 	double duration;
 
@@ -133,10 +365,38 @@ void omp_autotune_run(struct db_main *db)
 		salt = s->salt;
 	}
 
+	// When cracking, time whole salt loops over the real db's salts
+	workload = (use_workload && db->real && db->real->salts) ?
+		db->real : NULL;
+
+	if (use_cache) {
+		autotune_cache_key(cache_key, sizeof(cache_key), threads, tune_cost,
+		                   workload ? workload->salt_count : 0);
+
+		if (!force_tune && (scale = autotune_cache_get(cache_key))) {
+			if (john_main_process && options.verbosity > VERB_DEFAULT)
+				printf("Autotune cached best speed at %s %d\n",
+				       threads > 1 ? "OMP scale of" : "MKPC of",
+				       threads > 1 ? scale :
+				       scale * fmt->params.min_keys_per_crypt);
+			log_event("Autotune cached best speed at %s %d",
+			          threads > 1 ? "OMP scale of" : "MKPC of",
+			          threads > 1 ? scale :
+			          scale * fmt->params.min_keys_per_crypt);
+			last_scale = scale;
+			autotune_setup(threads);
+			goto cleanup;
+		}
+		scale = 1;
+	}
+
 	if (john_main_process && options.verbosity >= VERB_MAX) {
 		printf("%s %s autotune using %s db",
 		       fmt->params.label, threads > 1 ? "OMP" : "MKPC",
 		       db->real ? "real" : "test");
+		if (workload)
+			printf(", %d salt%s", workload->salt_count,
+			       workload->salt_count > 1 ? "s" : "");
 		if (fmt->methods.tunable_cost_value[0])
 			printf(" with %s of %d\n",
 			       fmt->params.tunable_cost_name[0], tune_cost);
@@ -144,53 +404,41 @@ void omp_autotune_run(struct db_main *db)
 	}
 
 	do {
-		int i;
 		int min_kpc = fmt->params.min_keys_per_crypt;
-		int this_kpc = mkpc * threads * scale;
+		int this_kpc;
 		int cps, crypts = 0;
 
-		if (threads == 1)
-			this_kpc = min_kpc * scale; // We're tuning MKPC
-
-		fmt->params.max_keys_per_crypt = this_kpc;
-
-		// Release old buffers
-		fmt->methods.done();
-
-		// Set up buffers for this test
-		fmt->methods.init(fmt);
+		autotune_setup(threads);
 
 		// Format may have bumped kpc in init()
 		this_kpc = fmt->params.max_keys_per_crypt;
 
-		// Load keys
-		fmt->methods.clear_keys();
-		for (i = 0; i < this_kpc; i++) {
-			key[4] = '0' + (i / 1000) % 10;
-			key[5] = '0' + (i / 100) % 10;
-			key[6] = '0' + (i / 10) % 10;
-			key[7] = '0' + i % 10;
-			fmt->methods.set_key(key, i);
-		}
+		if (workload)
+			crypts = autotune_workload(workload, this_kpc, min_crypts,
+			                           &duration);
+		else {
+			// Load keys
+			autotune_set_keys(this_kpc);
 
-		// Set the salt we picked earlier
-		fmt->methods.set_salt(salt);
+			// Set the salt we picked earlier
+			fmt->methods.set_salt(salt);
 
-		// Tell format this is a speed test
-		benchmark_running++;
+			// Tell format this is a speed test
+			benchmark_running++;
 
-		start = john_get_nano();
-		do {
-			int count = this_kpc;
+			start = john_get_nano();
+			do {
+				int count = this_kpc;
 
-			fmt->methods.crypt_all(&count, NULL);
-			crypts += count;
-			end = john_get_nano();
-		} while (crypts < min_crypts || (end - start) < sample_time);
+				fmt->methods.crypt_all(&count, NULL);
+				crypts += count;
+				end = john_get_nano();
+			} while (crypts < min_crypts || (end - start) < sample_time);
 
-		benchmark_running--;
+			benchmark_running--;
 
-		duration = (end - start) / 1E9;
+			duration = (end - start) / 1E9;
+		}
 		cps = crypts / duration;
 
 		if (john_main_process && options.verbosity >= VERB_MAX) {
@@ -262,14 +510,14 @@ void omp_autotune_run(struct db_main *db)
 		}
 	}
 
-	if (best_scale != scale) {
-		scale = best_scale;
+	last_scale = best_scale;
 
-		// Release old buffers
-		fmt->methods.done();
+	if (use_cache)
+		autotune_cache_put(cache_key, best_scale);
 
-		// Set up buffers for chosen scale
-		fmt->methods.init(fmt);
+	if (best_scale != scale) {
+		scale = best_scale;
+		autotune_setup(threads);
 	}
 
 cleanup:
@@ -281,3 +529,8 @@ cleanup:
 
 	return;
 }
+
+int omp_autotune_scale(void)
+{
+	return last_scale;
+}
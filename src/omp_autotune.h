@@ -12,4 +12,7 @@ extern void omp_autotune_init(void);
 extern int omp_autotune(struct fmt_main *format, int preset);
 extern void omp_autotune_run(struct db_main *db);
 
+/* OMP scale last set up by omp_autotune() or picked by omp_autotune_run() */
+extern int omp_autotune_scale(void);
+
 #endif /* _HAVE_OMP_AUTOTUNE_H */
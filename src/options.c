@@ -32,6 +32,8 @@
 #include "recovery.h"
 #include "options.h"
 #include "bench.h"
+#include "genbench.h"
+#include "lookbench.h"
 #include "external.h"
 #include "john.h"
 #include "dynamic.h"
@@ -143,6 +145,11 @@ static struct opt_entry opt_list[] = {
 	{"show", FLG_SHOW_SET, FLG_SHOW_CHK, 0, FLG_CRACKING_SUP | FLG_MAKECHR_CHK, OPT_FMT_STR_ALLOC, &show_uncracked_str},
 	{"test", FLG_TEST_SET, FLG_TEST_CHK, 0, TEST_REQ_CLR, "%d", &benchmark_time},
 	{"test-full", FLG_TEST_SET, FLG_TEST_CHK, 0, TEST_REQ_CLR | OPT_REQ_PARAM, "%d", &benchmark_level},
+	{"test-gen", FLG_GENBENCH_SET, FLG_GENBENCH_CHK, 0, ~FLG_GENBENCH_SET & ~GETOPT_FLAGS, "%d", &genbench_time},
+	{"test-lookup", FLG_LOOKUP_SET, FLG_LOOKUP_CHK, 0, ~FLG_LOOKUP_SET & ~FLG_FORMAT & ~FLG_SAVEMEM & ~FLG_VERBOSITY & ~GETOPT_FLAGS, "%d", &lookbench_time},
+	{"bench-repeat", FLG_ONCE, 0, FLG_TEST_CHK, OPT_REQ_PARAM, "%u", &options.bench_repeat},
+	{"bench-json", FLG_ONCE, 0, FLG_TEST_CHK, OPT_REQ_PARAM, OPT_FMT_STR_ALLOC, &options.bench_json},
+	{"bench-baseline", FLG_ONCE, 0, FLG_TEST_CHK, OPT_REQ_PARAM, OPT_FMT_STR_ALLOC, &options.bench_baseline},
 	{"stress-test", FLG_LOOPTEST_SET, FLG_LOOPTEST_CHK, 0, ~FLG_LOOPTEST_SET & TEST_REQ_CLR, "%d", &benchmark_time},
 #ifdef HAVE_FUZZ
 	{"fuzz", FLG_FUZZ_SET, FLG_FUZZ_CHK, 0, ~FLG_FUZZ_DUMP_SET & ~FLG_FUZZ_SET & ~FLG_FORMAT & ~FLG_SAVEMEM & ~FLG_NOLOG & ~GETOPT_FLAGS, OPT_FMT_STR_ALLOC, &options.fuzz_dic},
@@ -180,6 +187,9 @@ static struct opt_entry opt_list[] = {
 	{"max-candidates", FLG_ONCE, 0, FLG_CRACKING_CHK, USUAL_REQ_CLR | OPT_REQ_PARAM, "%lld", &options.max_cands},
 	{"max-run-time", FLG_ONCE, 0, FLG_CRACKING_CHK, USUAL_REQ_CLR | OPT_REQ_PARAM, "%d", &options.max_run_time},
 	{"progress-every", FLG_ONCE, 0, FLG_CRACKING_CHK, USUAL_REQ_CLR | OPT_REQ_PARAM, "%u", &options.status_interval},
+	{"metrics", FLG_ONCE, 0, FLG_CRACKING_CHK, USUAL_REQ_CLR | OPT_REQ_PARAM, OPT_FMT_STR_ALLOC, &options.metrics_file},
+	{"profile", FLG_ONCE, 0, 0, USUAL_REQ_CLR | OPT_BOOL, NULL, &options.profile},
+	{"pin", FLG_ONCE, 0, 0, USUAL_REQ_CLR | FLG_STDOUT | OPT_TRISTATE, OPT_FMT_STR_ALLOC, &options.pin},
 	{"regen-lost-salts", FLG_ONCE, 0, FLG_PWD_REQ, USUAL_REQ_CLR | OPT_REQ_PARAM, OPT_FMT_STR_ALLOC, &regen_salts_options},
 	{"bare-always-valid", FLG_ONCE, 0, FLG_PWD_REQ, OPT_REQ_PARAM, "%c", &options.dynamic_bare_hashes_always_valid},
 	{"reject-printable", FLG_REJECT_PRINTABLE, FLG_REJECT_PRINTABLE},
@@ -308,12 +318,23 @@ JOHN_USAGE_REGEX \
 "--restore[=NAME]           Restore an interrupted session [called NAME]\n" \
 "--[no-]crack-status        Emit a status line whenever a password is cracked\n" \
 "--progress-every=N         Emit a status line every N seconds\n" \
+"--metrics=FILE             Append JSON metrics records to FILE periodically\n" \
+"--profile                  Show where time goes in the hot path (cracking\n" \
+"                           and --test)\n" \
 "--show[=left]              Show cracked passwords [if =left, then uncracked]\n" \
 "--show=formats             Show information about hashes in a file (JSON)\n" \
 "--show=invalid             Show lines that are not valid for selected format(s)\n" \
 "--test[=TIME]              Run tests and benchmarks for TIME seconds each\n" \
 "                           (if TIME is explicitly 0, test w/o benchmark)\n" \
+"--bench-repeat=N           Run each benchmark N times and report the median\n" \
+"--bench-json=FILE          Write benchmark results and build info to FILE\n" \
+"--bench-baseline=FILE      Compare benchmark results against FILE, as written\n" \
+"                           by --bench-json, and fail on regressions\n" \
 "--stress-test[=TIME]       Loop self tests forever\n" \
+"--test-gen[=TIME]          Benchmark candidate generators for TIME seconds\n" \
+"                           each, see [List.Generators:Benchmark]\n" \
+"--test-lookup[=TIME]       Benchmark hash lookups with many hashes loaded\n" \
+"                           for TIME seconds each (needs --format)\n" \
 "--test-full=LEVEL          Run more thorough self-tests\n" \
 "--no-mask                  Used with --test for alternate benchmark w/o mask\n" \
 "--skip-self-tests          Skip self tests\n" \
@@ -325,6 +346,8 @@ JOHN_USAGE_REGEX \
 "--costs=[-]C[:M][,...]     Load salts with[out] cost value Cn [to Mn]. For\n" \
 "                           tunable cost parameters, see doc/OPTIONS\n" \
 JOHN_USAGE_FORK \
+"--pin[=cores]              Pin processes and threads to CPUs by topology, with\n" \
+"                           cores using one thread per physical core\n" \
 "--node=MIN[-MAX]/TOTAL     This node's number range out of TOTAL count\n" \
 "--save-memory=LEVEL        Enable memory saving, at LEVEL 1..3\n" \
 "--log-stderr               Log to screen instead of file\n"             \
@@ -356,7 +379,7 @@ FUZZ_USAGE \
 "--pot=NAME                 Pot file to use\n" \
 "--regen-lost-salts=N       Brute force unknown salts (see doc/OPTIONS)\n" \
 "--reject-printable         Reject printable binaries\n" \
-"--tune=HOW                 Tuning options (auto/report/N)\n" \
+"--tune=HOW                 Tuning options (auto/report/force/N)\n" \
 
 #define JOHN_USAGE_FORMAT \
 "--subformat=FORMAT         Pick a benchmark format for --format=crypt\n" \
@@ -466,6 +489,12 @@ void opt_init(char *name, int argc, char **argv)
 		error();
 	}
 
+	if ((options.flags & FLG_LOOKUP_CHK) && !(options.flags & FLG_FORMAT)) {
+		if (john_main_process)
+			fprintf(stderr, "--test-lookup needs --format\n");
+		error();
+	}
+
 #if HAVE_REXGEN
 	/* We allow regex as parent for hybrid mask, not vice versa */
 	if ((options.flags & FLG_REGEX_CHK) && (options.flags & FLG_MASK_CHK)) {
@@ -744,8 +773,9 @@ void opt_init(char *name, int argc, char **argv)
 	if (options.tune) {
 		if (strcmp(options.tune, "auto") &&
 		    strcmp(options.tune, "report") &&
+		    strcmp(options.tune, "force") &&
 		    !isdec(options.tune))
-			error_msg("Allowed arguments to --tune is auto, report or N, where N is a positive number");
+			error_msg("Allowed arguments to --tune is auto, report, force or N, where N is a positive number");
 	}
 
 	if (salts_str) {
@@ -124,8 +124,7 @@
  *           0x0000000080000000 is taken for OPT_REQ_PARAM, see getopt.h
  *
  * These are available for using!
- *		0x0000100000000000ULL
- *		0x0000200000000000ULL
+ *		(none left)
  */
 
 /* Subsets prefer finishing shorter lengths */
@@ -153,6 +152,14 @@
 #define FLG_SECOND_ENC			0x0000040000000000ULL
 /* --verbosity */
 #define FLG_VERBOSITY			0x0000080000000000ULL
+/* Benchmark candidate generators */
+#define FLG_GENBENCH_CHK		0x0000100000000000ULL
+#define FLG_GENBENCH_SET \
+	(FLG_GENBENCH_CHK | FLG_CRACKING_SUP | FLG_ACTION)
+/* Benchmark hash lookups at scale */
+#define FLG_LOOKUP_CHK			0x0000200000000000ULL
+#define FLG_LOOKUP_SET \
+	(FLG_LOOKUP_CHK | FLG_CRACKING_SUP | FLG_ACTION)
 /* Loops self-test forever */
 #define FLG_LOOPTEST_CHK		0x0000400000000000ULL
 #define FLG_LOOPTEST_SET		(FLG_LOOPTEST_CHK | FLG_TEST_SET)
@@ -398,6 +405,21 @@ struct options_main {
 /* Emit a status line every N seconds */
 	int status_interval;
 
+/* Append JSON metrics records to this file, every N seconds */
+	char *metrics_file;
+	int metrics_interval;
+
+/* Break down time spent in the hot path (--profile) */
+	int profile;
+
+/* Pin processes and threads to CPUs by topology (--pin[=cores]) */
+	char *pin;
+
+/* Benchmark repeat count, JSON output and baseline to compare against */
+	unsigned int bench_repeat;
+	char *bench_json;
+	char *bench_baseline;
+
 /* Resync pot file when saving */
 	int reload_at_save;
 
@@ -151,6 +151,17 @@
  */
 #define BENCHMARK_TIME			1
 
+/*
+ * Default candidate generator benchmark time in seconds (per generator and
+ * process count).  Modes spend some of it on startup, so it's longer.
+ */
+#define GENBENCH_TIME			5
+
+/*
+ * Default lookup benchmark time in seconds (per loaded hash count).
+ */
+#define LOOKBENCH_TIME			3
+
 /*
  * Number of salts to assume when benchmarking.
  */
@@ -174,11 +185,15 @@
 #define SEC_POT_NAME			JOHN_PRIVATE_HOME "/secure.pot"
 #define LOG_NAME			JOHN_PRIVATE_HOME "/john.log"
 #define RECOVERY_NAME			JOHN_PRIVATE_HOME "/john"
+#define TUNE_CACHE_NAME			JOHN_PRIVATE_HOME "/john.tune"
+#define MKV_CACHE_DIR			JOHN_PRIVATE_HOME
 #else
 #define POT_NAME			"$JOHN/john.pot"
 #define SEC_POT_NAME			"$JOHN/secure.pot"
 #define LOG_NAME			"$JOHN/john.log"
 #define RECOVERY_NAME			"$JOHN/john"
+#define TUNE_CACHE_NAME			"$JOHN/john.tune"
+#define MKV_CACHE_DIR			"$JOHN"
 #endif
 #define LOG_SUFFIX			".log"
 #define RECOVERY_SUFFIX			".rec"
@@ -200,6 +215,8 @@
 #define SECTION_DISABLED		"Disabled:"
 #define SUBSECTION_FORMATS		"Formats"
 #define SECTION_FORMATS			"Formats:"
+#define SECTION_GENBENCH		"List.Generators:"
+#define SUBSECTION_BENCHMARK		"Benchmark"
 
 /*
  * Number of different password hash table sizes.
@@ -286,9 +303,10 @@ extern unsigned int password_hash_thresholds[PASSWORD_HASH_SIZES];
  * Using 32-bit types, the real limit will be amount of available RAM and
  * the setting of SingleMaxBufferSize in john.conf (default 4 GB).
  *
- * Current code tries to decrease max_length (but no more than to 16) before
- * limiting KPC for number of salts vs. SINGLE_MAX_WORD_BUFFER (and both are
- * capped if needed).
+ * Buffers start small and grow on demand, within that limit, so salts with
+ * many candidates get full batches while the limit is shared by all salts.
+ * If not even SINGLE_HASH_MIN keys per salt fit, current code tries to
+ * decrease max_length (but no more than to 16).
  */
 #if HAVE_OPENCL
 /* Max. 2 GB memory buffer per salt. */
@@ -123,6 +123,9 @@
 #include "rules.h"
 #include "mask.h"
 #include "regex.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #define _STR_VALUE(arg) #arg
 #define STR_MACRO(n)    _STR_VALUE(n)
@@ -859,10 +862,51 @@ static int rec_pos_destroyed;
 static int rule_count;
 static struct list_main *rule_list;
 
+/*
+ * Candidates are generated in blocks of PP_CHUNK per thread.  A block is a
+ * list of segments, each being a run of consecutive keyspace positions in
+ * one chain, and every thread builds its own share of the block from the
+ * chain element positions alone.  The block is then tried in order, so the
+ * output doesn't depend on the thread count.
+ */
+#define PP_CHUNK      0x1000
+#define PP_SEGS       0x400
+#define PP_KEY_SIZE   (OUT_LEN_MAX + 1)
+
+typedef struct
+{
+  const chain_t *chain_buf;
+  int   pw_len;
+  u64   first;
+  u64   cnt;
+  u64   chain_ks_poses[OUT_LEN_MAX];
+
+} pp_seg_t;
+
+static int pp_threads;
+static pp_seg_t *pp_segs;
+static int pp_segs_cnt;
+static char *pp_keys;
+static u64 pp_keys_cnt;
+static u64 pp_keys_max;
+static u64 save_ofs;
+static mpz_t rec_start;
+
+/*
+ * Sessions using --node, --fork or MPI have each node walk its own contiguous
+ * part of the keyspace, marked "pp-v2" in the .rec file.  Sessions from
+ * before that picked runs by position modulo node count, and are resumed the
+ * same way.
+ */
+static int pp_node_range = 1;
+
 static void save_state(FILE *file)
 {
   mpz_t half; mpz_init(half);
 
+  if (options.node_count && pp_node_range)
+    fprintf(file, "pp-v2\n");
+
   mpz_fdiv_r_2exp(half, rec_pos, 64); // lower 64 bits
   fprintf(file, "%"PRIu64"\n", (uint64_t)mpz_get_ui(half));
 
@@ -873,8 +917,13 @@ static void save_state(FILE *file)
 static int restore_state(FILE *file)
 {
   uint64_t temp;
+  unsigned int version;
   mpz_t hi;
 
+  if (fscanf(file, "pp-v%u\n", &version) != 1)
+    version = 1;
+  pp_node_range = (version >= 2);
+
   if (fscanf(file, "%"PRIu64"\n", &temp) != 1)
     return 1;
   mpz_set_ui(rec_pos, temp);
@@ -895,13 +944,234 @@ static void fix_state(void)
     mpz_set(rec_pos, hybrid_rec_pos);
     mpz_set_ui(hybrid_rec_pos, 0);
   } else {
-    mpz_set(rec_pos, save);
+    mpz_add_ui(rec_pos, save, save_ofs);
   }
 }
 
+/*
+ * Called when the hybrid mode is done with a word (after its last rule, if
+ * any), so a resumed session starts at the next one.
+ */
 void pp_hybrid_fix_state(void)
 {
-  mpz_set(hybrid_rec_pos, save);
+  mpz_add_ui(hybrid_rec_pos, save, save_ofs + 1);
+}
+
+/*
+ * Advance the element positions of a chain by add keyspace positions, like
+ * that many calls to chain_set_pwbuf_increment() would.
+ */
+static void chain_add_ks_poses (const chain_t *chain_buf, const db_entry_t *db_entries, u64 cur_chain_ks_poses[OUT_LEN_MAX], u64 add)
+{
+  const u8 *buf = chain_buf->buf;
+
+  const int cnt = chain_buf->cnt;
+
+  for (int idx = 0; idx < cnt && add; idx++)
+  {
+    const u8 db_key = buf[idx];
+
+    const db_entry_t *db_entry = &db_entries[db_key];
+
+    const u64 elems_cnt = db_entry->elems_cnt;
+
+    u64 elems_idx = cur_chain_ks_poses[idx] + add % elems_cnt;
+
+    add /= elems_cnt;
+
+    if (elems_idx >= elems_cnt)
+    {
+      elems_idx -= elems_cnt;
+
+      add++;
+    }
+
+    cur_chain_ks_poses[idx] = elems_idx;
+  }
+}
+
+/*
+ * Write the keys with block index [start, end) to pp_keys.  This only reads
+ * shared data, so threads can run it on disjoint ranges at once.
+ */
+static void pp_gen_keys (const db_entry_t *db_entries, u64 start, u64 end)
+{
+  int segs_idx = 0;
+
+  while (segs_idx < pp_segs_cnt - 1 && pp_segs[segs_idx + 1].first <= start) segs_idx++;
+
+  while (start < end)
+  {
+    const pp_seg_t *seg = &pp_segs[segs_idx++];
+
+    const u64 seg_end = MIN(end, seg->first + seg->cnt);
+
+    u64 cur_chain_ks_poses[OUT_LEN_MAX];
+
+    char pw_buf[PP_KEY_SIZE];
+
+    memcpy (cur_chain_ks_poses, seg->chain_ks_poses, sizeof (cur_chain_ks_poses));
+
+    chain_add_ks_poses (seg->chain_buf, db_entries, cur_chain_ks_poses, start - seg->first);
+
+    chain_set_pwbuf_init (seg->chain_buf, db_entries, cur_chain_ks_poses, pw_buf);
+
+    pw_buf[seg->pw_len] = '\0';
+
+    while (1)
+    {
+      memcpy (pp_keys + start * PP_KEY_SIZE, pw_buf, seg->pw_len + 1);
+
+      if (++start == seg_end) break;
+
+      chain_set_pwbuf_increment (seg->chain_buf, db_entries, cur_chain_ks_poses, pw_buf);
+    }
+  }
+}
+
+/*
+ * Try one PRINCE word, with rules and/or whatever hybrid mode we're
+ * stacked with.  Returns non-zero when we're done.
+ */
+static int pp_process_key (struct db_main *db, char *pw_buf, int rules, char **last)
+{
+  char key_e[PLAINTEXT_BUFFER_SIZE];
+  char *key;
+
+  if (!rules) {
+#if HAVE_REXGEN
+    if (regex) {
+      if (do_regex_hybrid_crack(db, regex, pw_buf, regex_case, regex_alpha))
+        return 1;
+      pp_hybrid_fix_state();
+    } else
+#endif
+    if (f_new) {
+      if (do_external_hybrid_crack(db, pw_buf))
+        return 1;
+      pp_hybrid_fix_state();
+    } else
+    if (options.flags & FLG_MASK_CHK) {
+      if (do_mask_crack(pw_buf))
+        return 1;
+    } else
+    {
+      key = pw_buf;
+      if (!f_filter || ext_filter_body(pw_buf, key = key_e))
+        if (crk_process_key(key))
+          return 1;
+    }
+  } else {
+    struct list_entry *rule;
+
+    if ((rule = rule_list->head))
+    do {
+      char *word;
+
+      if ((word = rules_apply(pw_buf, rule->data, -1, *last))) {
+        *last = word;
+#if HAVE_REXGEN
+        if (regex) {
+          if (do_regex_hybrid_crack(db, regex, word, regex_case, regex_alpha))
+            return 1;
+        } else
+#endif
+        if (f_new) {
+          if (do_external_hybrid_crack(db, word))
+            return 1;
+        } else
+        if (options.flags & FLG_MASK_CHK) {
+          if (do_mask_crack(word))
+            return 1;
+        } else
+        {
+          key = word;
+          if (!f_filter || ext_filter_body(word, key = key_e))
+            if (crk_process_key(key))
+              return 1;
+        }
+      }
+    } while ((rule = rule->next));
+
+#if HAVE_REXGEN
+    if (regex)
+      pp_hybrid_fix_state();
+    else
+#endif
+    if (f_new)
+      pp_hybrid_fix_state();
+  }
+
+  return event_abort;
+}
+
+/*
+ * Generate the queued block using all threads, then try it in order.
+ */
+static int pp_flush (struct db_main *db, const db_entry_t *db_entries, int rules, char **last)
+{
+  const u64 keys_cnt = pp_keys_cnt;
+
+  int t;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(pp_threads)
+#endif
+  for (t = 0; t < pp_threads; t++)
+  {
+    pp_gen_keys (db_entries, keys_cnt * t / pp_threads, keys_cnt * (t + 1) / pp_threads);
+  }
+
+  pp_segs_cnt = 0;
+  pp_keys_cnt = 0;
+
+  for (save_ofs = 0; save_ofs < keys_cnt; save_ofs++)
+  {
+    if (pp_process_key (db, pp_keys + save_ofs * PP_KEY_SIZE, rules, last)) return 1;
+  }
+
+  mpz_add_ui (save, save, keys_cnt);
+
+  save_ofs = 0;
+
+  return 0;
+}
+
+/*
+ * Queue cnt keys of a chain, starting at the given element positions.
+ */
+static int pp_add_keys (struct db_main *db, const db_entry_t *db_entries, int rules, char **last, const chain_t *chain_buf, const int pw_len, const u64 cur_chain_ks_poses[OUT_LEN_MAX], u64 cnt)
+{
+  u64 chain_ks_poses[OUT_LEN_MAX];
+
+  memcpy (chain_ks_poses, cur_chain_ks_poses, sizeof (chain_ks_poses));
+
+  while (cnt)
+  {
+    if (pp_segs_cnt == PP_SEGS || pp_keys_cnt == pp_keys_max)
+    {
+      if (pp_flush (db, db_entries, rules, last)) return 1;
+    }
+
+    pp_seg_t *seg = &pp_segs[pp_segs_cnt++];
+
+    const u64 seg_cnt = MIN(cnt, pp_keys_max - pp_keys_cnt);
+
+    seg->chain_buf = chain_buf;
+    seg->pw_len    = pw_len;
+    seg->first     = pp_keys_cnt;
+    seg->cnt       = seg_cnt;
+
+    memcpy (seg->chain_ks_poses, chain_ks_poses, sizeof (chain_ks_poses));
+
+    pp_keys_cnt += seg_cnt;
+
+    cnt -= seg_cnt;
+
+    if (cnt) chain_add_ks_poses (chain_buf, db_entries, chain_ks_poses, seg_cnt);
+  }
+
+  return 0;
 }
 
 static double get_progress(void)
@@ -913,7 +1183,11 @@ static double get_progress(void)
 
   mpf_init(fpos); mpf_init(perc);
 
-  mpf_set_z(fpos, rec_pos);
+  mpz_t pos; mpz_init(pos);
+
+  mpz_sub(pos, rec_pos, rec_start);
+  mpf_set_z(fpos, pos);
+  mpz_clear(pos);
   if (mpf_sgn(count))
     mpf_div(perc, fpos, count);
   progress = 100.0 * mpf_get_d(perc);
@@ -1005,6 +1279,7 @@ void do_prince_crack(struct db_main *db, const char *wordlist, int rules)
   mpf_init_set_ui(count,     1);
   mpz_init_set_ui(rec_pos,   0);
   mpz_init_set_ui(hybrid_rec_pos,   0);
+  mpz_init_set_ui(rec_start, 0);
 #endif
   int     keyspace      = 0;
   int     pw_min        = PW_MIN;
@@ -1898,10 +2173,8 @@ void do_prince_crack(struct db_main *db, const char *wordlist, int rules)
   rec_restore_mode(restore_state);
   rec_init(db, save_state);
 
-  if (mpz_cmp_ui(rec_pos, 0))
-  {
-    mpz_set(skip, rec_pos);
-  }
+  /* crk_init() will overwrite rec_pos, so keep the restored position here */
+  mpz_set(rec_start, rec_pos);
 
   log_event("Calculating keyspace");
   size_t tot_mem = (pw_max + 1) * (sizeof(db_entry_t) + sizeof(pw_order_t) + sizeof(u64));
@@ -1936,10 +2209,7 @@ void do_prince_crack(struct db_main *db, const char *wordlist, int rules)
 
     mpz_add (total_ks_cnt, total_ks_cnt, tmp);
 
-    if (mpz_cmp_si (skip, 0))
-    {
-      mpz_init_set (pw_ks_cnt[pw_len], tmp);
-    }
+    mpz_init_set (pw_ks_cnt[pw_len], tmp);
   }
 
 #if FAKE_GMP
@@ -1981,11 +2251,21 @@ void do_prince_crack(struct db_main *db, const char *wordlist, int rules)
       log_event("- Memory use for PRINCE: "Zu" bytes", tot_mem);
   }
 
-  mpf_set_z(count, total_ks_cnt);
-  mpf_mul_ui(count, count, rule_count);
-
   crk_init(db, fix_state, NULL);
 
+#ifdef _OPENMP
+  if ((pp_threads = cfg_get_int(SECTION_OPTIONS, NULL, "PrinceThreads")) <= 0)
+    pp_threads = omp_get_max_threads();
+#else
+  pp_threads = 1;
+#endif
+  pp_keys_max = (u64)pp_threads * PP_CHUNK;
+  pp_keys = mem_alloc(pp_keys_max * PP_KEY_SIZE);
+  pp_segs = mem_alloc(PP_SEGS * sizeof(pp_seg_t));
+
+  if (pp_threads > 1)
+    log_event("- Generating candidates using %d threads", pp_threads);
+
   if (dupe_check || rules) {
     int force = (dupe_check || (options.flags & FLG_STDOUT)) && options.suppressor_size;
     suppressor_init(SUPPRESSOR_UPDATE | (force ? SUPPRESSOR_FORCE : 0));
@@ -2080,13 +2360,71 @@ void do_prince_crack(struct db_main *db, const char *wordlist, int rules)
     mpz_set (total_ks_cnt, tmp);
   }
 
+#ifdef JTR_MODE
+  /**
+   * with --node, --fork or MPI, each node gets an even, contiguous part of
+   * the keyspace and seeks directly to it
+   */
+
+  if (options.node_count && pp_node_range)
+  {
+    mpz_t node_ks_cnt; mpz_init (node_ks_cnt);
+
+    mpz_sub (node_ks_cnt, total_ks_cnt, skip);
+
+    const u64 node_ks_rem = mpz_fdiv_ui (node_ks_cnt, options.node_count);
+
+    mpz_fdiv_q_ui (node_ks_cnt, node_ks_cnt, options.node_count);
+
+    mpz_mul_ui (tmp, node_ks_cnt, options.node_max);
+    mpz_add_ui (tmp, tmp, MIN(node_ks_rem, options.node_max));
+    mpz_add (total_ks_cnt, skip, tmp);
+
+    mpz_mul_ui (tmp, node_ks_cnt, options.node_min - 1);
+    mpz_add_ui (tmp, tmp, MIN(node_ks_rem, options.node_min - 1));
+    mpz_add (skip, skip, tmp);
+
+    mpz_clear (node_ks_cnt);
+
+    char l_start[64], l_end[64];
+
+    mpz_get_str(l_start, 10, skip);
+    mpz_get_str(l_end, 10, total_ks_cnt);
+    log_event("- Node keyspace range %s - %s", l_start, l_end);
+  }
+
+  mpz_set (tmp, rec_start);
+
+  mpz_set (rec_start, skip);
+
+  mpz_sub (iter_max, total_ks_cnt, skip);
+  mpf_set_z (count, iter_max);
+  mpf_mul_ui (count, count, rule_count);
+
+  if (options.node_count && !pp_node_range)
+  {
+    log_event("- Resuming a session with the old node split by position modulo node count");
+    mpf_mul_ui (count, count, options.node_max - options.node_min + 1);
+    mpf_div_ui (count, count, options.node_count);
+  }
+
+  if (mpz_cmp (tmp, skip) > 0)
+  {
+    mpz_set (skip, tmp);
+  }
+#endif
+
   mpz_init_set (save, skip);
 
   /**
    * skip to the first main loop that will output a password
    */
 
-  if (mpz_cmp_si (skip, 0))
+  if (mpz_cmp (skip, total_ks_cnt) >= 0)
+  {
+    mpz_set (total_ks_pos, total_ks_cnt);
+  }
+  else if (mpz_cmp_si (skip, 0))
   {
     mpz_t skip_left;  mpz_init_set (skip_left, skip);
     mpz_t main_loops; mpz_init (main_loops);
@@ -2179,7 +2517,6 @@ void do_prince_crack(struct db_main *db, const char *wordlist, int rules)
 
     for (int pw_len = pw_min; pw_len <= pw_max; pw_len++)
     {
-      mpz_clear (pw_ks_cnt[pw_len]);
       mpz_clear (pw_ks_pos[pw_len]);
     }
 
@@ -2218,12 +2555,10 @@ void do_prince_crack(struct db_main *db, const char *wordlist, int rules)
 
       const int pw_len = pw_order->len;
 
+#ifndef JTR_MODE
       char pw_buf[BUFSIZ];
 
-#ifndef JTR_MODE
       pw_buf[pw_len] = '\n';
-#else
-      pw_buf[pw_len] = '\0';
 #endif
 
       db_entry_t *db_entry = &db_entries[pw_len];
@@ -2267,7 +2602,7 @@ void do_prince_crack(struct db_main *db, const char *wordlist, int rules)
 
 #ifdef JTR_MODE
         u32 for_node, node_skip = 0;
-        if (options.node_count)
+        if (options.node_count && !pp_node_range)
         {
           for_node = mpz_fdiv_ui(total_ks_pos,options.node_count) + 1;
           node_skip = for_node < options.node_min ||
@@ -2291,82 +2626,23 @@ void do_prince_crack(struct db_main *db, const char *wordlist, int rules)
             set_chain_ks_poses (chain_buf, db_entries, &tmp, db_entry->cur_chain_ks_poses);
           }
 
+#ifdef JTR_MODE
+          jtr_done = pp_add_keys (db, db_entries, rules, &last, chain_buf, pw_len, db_entry->cur_chain_ks_poses, iter_max_u64 - iter_pos_u64);
+
+          mpz_add (tmp, chain_buf->ks_pos, iter_max);
+
+          set_chain_ks_poses (chain_buf, db_entries, &tmp, db_entry->cur_chain_ks_poses);
+
+          if (jtr_done || event_abort)
+            break;
+#else
           chain_set_pwbuf_init (chain_buf, db_entries, db_entry->cur_chain_ks_poses, pw_buf);
 
           const u64 iter_pos_save = iter_max_u64 - iter_pos_u64;
 
           while (iter_pos_u64 < iter_max_u64)
           {
-#ifndef JTR_MODE
             out_push (out, pw_buf, pw_len + 1);
-#else
-            char key_e[PLAINTEXT_BUFFER_SIZE];
-            char *key;
-
-            if (!rules) {
-#if HAVE_REXGEN
-              if (regex) {
-                if ((jtr_done = do_regex_hybrid_crack(db, regex, pw_buf,
-                                                      regex_case, regex_alpha)))
-                  break;
-                pp_hybrid_fix_state();
-              } else
-#endif
-              if (f_new) {
-                if ((jtr_done = do_external_hybrid_crack(db, pw_buf)))
-                  break;
-                pp_hybrid_fix_state();
-              } else
-              if (options.flags & FLG_MASK_CHK) {
-                if ((jtr_done = do_mask_crack(pw_buf)))
-                  break;
-              } else
-              {
-                key = pw_buf;
-                if (!f_filter || ext_filter_body(pw_buf, key = key_e))
-                  if ((jtr_done = crk_process_key(key)))
-                    break;
-              }
-            } else {
-              struct list_entry *rule;
-
-              if ((rule = rule_list->head))
-              do {
-                char *word;
-
-                if ((word = rules_apply(pw_buf, rule->data, -1, last))) {
-                  last = word;
-#if HAVE_REXGEN
-                  if (regex) {
-                    if ((jtr_done = do_regex_hybrid_crack(db, regex, word,
-                                                          regex_case,
-                                                          regex_alpha)))
-                      break;
-                    pp_hybrid_fix_state();
-                  } else
-#endif
-                  if (f_new) {
-                    if (do_external_hybrid_crack(db, word))
-                      break;
-                    pp_hybrid_fix_state();
-                  } else
-                  if (options.flags & FLG_MASK_CHK) {
-                    if ((jtr_done = do_mask_crack(word)))
-                      break;
-                  } else
-                  {
-                    key = word;
-                    if (!f_filter || ext_filter_body(word, key = key_e))
-                      if ((jtr_done = crk_process_key(key)))
-                        break;
-                  }
-                }
-              } while ((rule = rule->next));
-
-              if (jtr_done || event_abort)
-                break;
-            }
-#endif
 
             chain_set_pwbuf_increment (chain_buf, db_entries, db_entry->cur_chain_ks_poses, pw_buf);
 
@@ -2374,9 +2650,6 @@ void do_prince_crack(struct db_main *db, const char *wordlist, int rules)
           }
 
           mpz_add_ui (save, save, iter_pos_save);
-#ifdef JTR_MODE
-          if (jtr_done || event_abort)
-            break;
 #endif
         }
         else
@@ -2418,7 +2691,10 @@ void do_prince_crack(struct db_main *db, const char *wordlist, int rules)
 #endif
   }
 
-#ifndef JTR_MODE
+#ifdef JTR_MODE
+  if (!jtr_done && !event_abort)
+    jtr_done = pp_flush (db, db_entries, rules, &last);
+#else
   out_flush (out);
 
   if (save_pos)
@@ -2449,6 +2725,11 @@ void do_prince_crack(struct db_main *db, const char *wordlist, int rules)
   mpz_clear (tmp);
   mpz_clear (save);
 
+  for (int pw_len = pw_min; pw_len <= pw_max; pw_len++)
+  {
+    mpz_clear (pw_ks_cnt[pw_len]);
+  }
+
   for (int pw_len = pw_min; pw_len <= pw_max; pw_len++)
   {
     db_entry_t *db_entry = &db_entries[pw_len];
@@ -2493,6 +2774,9 @@ void do_prince_crack(struct db_main *db, const char *wordlist, int rules)
   mpf_clear(count);
   rec_pos_destroyed = 1;
   mpz_clear(rec_pos);
+  mpz_clear(rec_start);
+  MEM_FREE(pp_segs);
+  MEM_FREE(pp_keys);
 #endif
 }
 
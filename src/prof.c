@@ -0,0 +1,98 @@
+/*
+ * This file is part of John the Ripper password cracker.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted.
+ *
+ * There's ABSOLUTELY NO WARRANTY, express or implied.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "options.h"
+#include "status.h"
+#include "prof.h"
+
+int prof_enabled;
+unsigned int prof_stage;
+uint64_t prof_mark, prof_ticks[PROF_STAGES], prof_calls[PROF_STAGES];
+uint64_t prof_cands;
+
+/* What timing an empty span reads, to take out of sampled calls */
+static uint64_t prof_overhead;
+
+static const char *prof_names[PROF_STAGES] = {
+	"gen", "set_key", "crypt", "lookup", "cmp_exact", "guess",
+	"filter", "suppressor", "other"
+};
+
+void prof_init(unsigned int stage)
+{
+	int i;
+
+	prof_enabled = options.profile;
+
+	prof_overhead = ~(uint64_t)0;
+	for (i = 0; i < 100; i++) {
+		uint64_t start = prof_now();
+		uint64_t ticks = prof_now() - start;
+
+		if (ticks < prof_overhead)
+			prof_overhead = ticks;
+	}
+
+	memset(prof_ticks, 0, sizeof(prof_ticks));
+	memset(prof_calls, 0, sizeof(prof_calls));
+	prof_stage = stage;
+	prof_cands = status.cands;
+	prof_mark = prof_now();
+}
+
+char *prof_report(char *buffer, size_t size, uint64_t count, const char *unit)
+{
+	double ticks[PROF_STAGES], total = 0;
+	size_t n = 0;
+	int i;
+
+	/* Charge the current stage up to now */
+	prof_switch(prof_stage);
+
+	for (i = 0; i < PROF_STAGES; i++)
+		total += ticks[i] = prof_ticks[i];
+
+	/* Scale up sampled stages, whose other calls were charged to gen */
+	for (i = 0; i < PROF_STAGES; i++) {
+		uint64_t timed = (prof_calls[i] + PROF_SAMPLE - 1) / PROF_SAMPLE;
+		double extra;
+
+		if (!timed)
+			continue;
+		/* Our own overhead isn't anyone's */
+		extra = (double)timed * prof_overhead;
+		if (extra > ticks[i])
+			extra = ticks[i];
+		ticks[i] -= extra;
+		total -= extra;
+		extra = ticks[i] * (prof_calls[i] - timed) / timed;
+		if (extra > ticks[PROF_GEN])
+			extra = ticks[PROF_GEN];
+		ticks[i] += extra;
+		ticks[PROF_GEN] -= extra;
+	}
+
+	*buffer = 0;
+	for (i = 0; i < PROF_STAGES && n < size; i++) {
+		if (!ticks[i])
+			continue;
+		n += snprintf(buffer + n, size - n, "%s%s %.1f%%",
+		              n ? ", " : "", prof_names[i],
+		              100.0 * ticks[i] / total);
+	}
+
+	if (count && n < size)
+		snprintf(buffer + n, size - n, "%s%.0f ticks/%s",
+		         n ? ", " : "", total / count, unit);
+
+	return buffer;
+}
@@ -0,0 +1,126 @@
+/*
+ * This file is part of John the Ripper password cracker.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted.
+ *
+ * There's ABSOLUTELY NO WARRANTY, express or implied.
+ */
+
+/*
+ * Hot path time breakdown (--profile).
+ *
+ * One stage is current at any time.  prof_switch() reads a cheap tick counter,
+ * charges the ticks since the previous switch to the stage being left and
+ * makes another stage current.  Whatever runs outside of the instrumented
+ * calls - that is, the cracking mode producing candidates - is charged to
+ * PROF_GEN.  Only the main thread may switch stages.
+ *
+ * Reading the counter twice per candidate would cost more than some formats
+ * spend on it, so stages entered per candidate from PROF_GEN only time one
+ * call in PROF_SAMPLE (see prof_sample()).  The report scales those up and
+ * takes the difference out of PROF_GEN.
+ */
+
+#ifndef _JOHN_PROF_H
+#define _JOHN_PROF_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#elif !defined(__aarch64__)
+#include <time.h>
+#endif
+
+#define PROF_GEN			0
+#define PROF_SET_KEY			1
+#define PROF_CRYPT			2
+#define PROF_LOOKUP			3
+#define PROF_CMP_EXACT			4
+#define PROF_GUESS			5
+#define PROF_FILTER			6
+#define PROF_SUPPRESSOR			7
+#define PROF_OTHER			8
+#define PROF_STAGES			9
+
+#define PROF_SAMPLE			64
+
+/*
+ * Non-zero while profiling.
+ */
+extern int prof_enabled;
+
+extern unsigned int prof_stage;
+extern uint64_t prof_mark, prof_ticks[PROF_STAGES], prof_calls[PROF_STAGES];
+
+/*
+ * status.cands as of prof_init().
+ */
+extern uint64_t prof_cands;
+
+/*
+ * TSC on x86 and the virtual counter on ARMv8 (neither are CPU cycles on
+ * every CPU, but they are constant rate and cost next to nothing to read),
+ * nanoseconds elsewhere.
+ */
+static inline uint64_t prof_now(void)
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	return __rdtsc();
+#elif defined(__aarch64__)
+	uint64_t t;
+
+	__asm__ __volatile__("mrs %0, cntvct_el0" : "=r" (t));
+	return t;
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+/*
+ * Makes stage current, returning the previous one for restoring it.
+ */
+static inline unsigned int prof_switch(unsigned int stage)
+{
+	uint64_t now = prof_now();
+	unsigned int prev = prof_stage;
+
+	prof_ticks[prev] += now - prof_mark;
+	prof_mark = now;
+	prof_stage = stage;
+
+	return prev;
+}
+
+/*
+ * Counts a call to a sampled stage, returning non-zero if this one is to be
+ * timed with prof_switch().
+ */
+static inline int prof_sample(unsigned int stage)
+{
+	return !(prof_calls[stage]++ & (PROF_SAMPLE - 1));
+}
+
+/*
+ * Clears the counters and makes stage current.  Enables profiling if
+ * --profile was given.
+ */
+extern void prof_init(unsigned int stage);
+
+/*
+ * Formats the share of each stage seen so far, and the ticks spent per unit
+ * if count is non-zero, e.g. "gen 20.1%, crypt 75.3%, ..., 41 ticks/p".
+ */
+extern char *prof_report(char *buffer, size_t size, uint64_t count,
+	const char *unit);
+
+#endif
@@ -23,10 +23,13 @@ john_register_one(&fmt_rawBLAKE2);
 #include "params.h"
 #include "common.h"
 #include "formats.h"
+#include "simd-intrinsics.h"
 
 #define FORMAT_LABEL            "Raw-Blake2"
 #define FORMAT_NAME             ""
-#if !defined(JOHN_NO_SIMD) && defined(__XOP__)
+#if SIMD_COEF_64 >= 4
+#define ALGORITHM_NAME          BLAKE2B_ALGORITHM_NAME
+#elif !defined(JOHN_NO_SIMD) && defined(__XOP__)
 #define ALGORITHM_NAME          "128/128 XOP"
 #elif !defined(JOHN_NO_SIMD) && defined(__AVX__)
 #define ALGORITHM_NAME          "128/128 AVX"
@@ -49,7 +52,11 @@ john_register_one(&fmt_rawBLAKE2);
 #define SALT_SIZE               0
 #define BINARY_ALIGN            4
 #define SALT_ALIGN              1
+#if SIMD_COEF_64 >= 4
+#define MIN_KEYS_PER_CRYPT      SIMD_COEF_64
+#else
 #define MIN_KEYS_PER_CRYPT      1
+#endif
 #define MAX_KEYS_PER_CRYPT      64
 
 #ifndef OMP_SCALE
@@ -160,8 +167,20 @@ static int crypt_all(int *pcount, struct db_salt *salt)
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-	for (index = 0; index < count; index++) {
+	for (index = 0; index < count; index += MIN_KEYS_PER_CRYPT) {
+#if SIMD_COEF_64 >= 4
+		const unsigned char *in[SIMD_COEF_64];
+		unsigned char *out[SIMD_COEF_64];
+		int i;
+
+		for (i = 0; i < SIMD_COEF_64; i++) {
+			in[i] = (unsigned char*)saved_key[index + i];
+			out[i] = (unsigned char*)crypt_out[index + i];
+		}
+		SIMDBlake2b(in, &saved_len[index], out, BINARY_SIZE);
+#else
 		(void)blake2b((uint8_t *)crypt_out[index], 64, saved_key[index], saved_len[index], NULL, 0);
+#endif
 	}
 
 	return count;
@@ -24,13 +24,18 @@ john_register_one(&fmt_rawKeccak);
 #include "formats.h"
 #include "options.h"
 #include "KeccakHash.h"
+#include "simd-intrinsics.h"
 
 #define FORMAT_LABEL		"Raw-Keccak"
 #define FORMAT_NAME		""
 #define FORMAT_TAG           "$keccak$"
 #define FORMAT_TAG_LEN       (sizeof(FORMAT_TAG)-1)
 
+#if SIMD_COEF_64 >= 4
+#define ALGORITHM_NAME			KECCAK_ALGORITHM_NAME
+#else
 #define ALGORITHM_NAME			"32/" ARCH_BITS_STR
+#endif
 
 #define BENCHMARK_COMMENT		""
 #define BENCHMARK_LENGTH		0x107
@@ -44,7 +49,11 @@ john_register_one(&fmt_rawKeccak);
 #define BINARY_ALIGN			4
 #define SALT_ALIGN			1
 
+#if SIMD_COEF_64 >= 4
+#define MIN_KEYS_PER_CRYPT		SIMD_COEF_64
+#else
 #define MIN_KEYS_PER_CRYPT		1
+#endif
 #define MAX_KEYS_PER_CRYPT		256
 
 #ifndef OMP_SCALE
@@ -150,11 +159,23 @@ static int crypt_all(int *pcount, struct db_salt *salt)
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-	for (index = 0; index < count; index++) {
+	for (index = 0; index < count; index += MIN_KEYS_PER_CRYPT) {
+#if SIMD_COEF_64 >= 4
+		const unsigned char *in[SIMD_COEF_64];
+		unsigned char *out[SIMD_COEF_64];
+		int i;
+
+		for (i = 0; i < SIMD_COEF_64; i++) {
+			in[i] = (unsigned char*)saved_key[index + i];
+			out[i] = (unsigned char*)crypt_out[index + i];
+		}
+		SIMDKeccak(in, &saved_len[index], out, 72, BINARY_SIZE, 0x01);
+#else
 		Keccak_HashInstance hash;
 		Keccak_HashInitialize(&hash, 576, 1024, 512, 0x01);
 		Keccak_HashUpdate(&hash, (unsigned char*)saved_key[index], saved_len[index] * 8);
 		Keccak_HashFinal(&hash, (unsigned char*)crypt_out[index]);
+#endif
 	}
 
 	return count;
@@ -61,6 +61,14 @@
 #include "jumbo.h"
 #include "opencl_common.h"
 
+#if HAVE_PTHREAD && !(__DJGPP__ || _MSC_VER || __MINGW32__ || __MINGW64__ || __CYGWIN__ || HAVE_WINDOWS_H)
+#define REC_ASYNC			1
+#include <pthread.h>
+#include <signal.h>
+#else
+#define REC_ASYNC			0
+#endif
+
 char *rec_name = RECOVERY_NAME;
 int rec_name_completed = 0;
 int rec_version = 0;
@@ -79,6 +87,25 @@ static void (*rec_save_mode3)(FILE *file);
 
 extern int crk_max_keys_per_crypt();
 
+#if REC_ASYNC
+/*
+ * Periodic saves (rec_save_async()) write the new state to a separate file,
+ * opened and locked beforehand, and leave it to a background thread to sync
+ * it, rename it over the old one (taking the lock along) and sync the log and
+ * pot files.  The thread then opens the file for the next save.  This way, a
+ * slow filesystem doesn't stall cracking.
+ */
+static pthread_t rec_thread;
+static pthread_mutex_t rec_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t rec_cond = PTHREAD_COND_INITIALIZER;
+static int rec_async = -1, rec_thread_started, rec_busy;
+/* path_expand() isn't thread-safe, so the thread uses copies */
+static char rec_path[PATH_BUFFER_SIZE + 1], rec_tmp_path[PATH_BUFFER_SIZE + 5];
+static FILE *rec_next, *rec_job_new, *rec_job_old;
+static const char *rec_failed;
+static int rec_errno;
+#endif
+
 static void rec_name_complete(void)
 {
 	if (rec_name_completed)
@@ -231,7 +258,160 @@ static void save_salt_state()
 	fprintf(rec_file, "%d\n", crk_max_keys_per_crypt());
 }
 
-void rec_save(void)
+#if REC_ASYNC
+/*
+ * Creates and locks the file for the next save.  Runs in either thread, so
+ * it doesn't exit on failure but returns NULL.
+ */
+static FILE *rec_open_next(void)
+{
+	struct flock lock;
+	FILE *file;
+	int fd;
+
+	if ((fd = open(rec_tmp_path, O_RDWR | O_CREAT | O_TRUNC, 0600)) < 0)
+		return NULL;
+
+	/* Same as jtr_lock(), which would exit */
+	memset(&lock, 0, sizeof(lock));
+	lock.l_type = F_WRLCK;
+	if (fcntl(fd, F_SETLK, &lock) || !(file = fdopen(fd, "w"))) {
+		close(fd);
+		unlink(rec_tmp_path);
+		return NULL;
+	}
+
+	return file;
+}
+
+static void rec_write_job(void)
+{
+	const char *failed = NULL;
+	int error = 0;
+
+	if (fflush(rec_job_new))
+		failed = "fflush";
+	else if (!options.fork && fsync(fileno(rec_job_new)))
+		failed = "fsync";
+	else if (rename(rec_tmp_path, rec_path))
+		failed = "rename";
+	if (failed)
+		error = errno;
+
+	/* This releases our lock on the file just replaced */
+	if (fclose(rec_job_old) && !failed) {
+		failed = "fclose";
+		error = errno;
+	}
+	rec_job_old = NULL;
+
+	if (!failed && log_sync()) {
+		failed = "fsync";
+		error = errno;
+	}
+
+	if (failed) {
+		rec_errno = error;
+		rec_failed = failed;
+		/* Have the main thread report it now rather than at the next save */
+		event_save = event_pending = 1;
+		return;
+	}
+
+	rec_next = rec_open_next();
+}
+
+static void *rec_writer(void *arg)
+{
+	pthread_mutex_lock(&rec_mutex);
+	while (1) {
+		while (!rec_busy)
+			pthread_cond_wait(&rec_cond, &rec_mutex);
+		pthread_mutex_unlock(&rec_mutex);
+
+		rec_write_job();
+
+		pthread_mutex_lock(&rec_mutex);
+		rec_busy = 0;
+		pthread_cond_broadcast(&rec_cond);
+	}
+
+	return NULL;
+}
+
+static int rec_start_thread(void)
+{
+	sigset_t all, old;
+	int error;
+
+	if (rec_thread_started)
+		return 0;
+
+	/* Leave the signals to the main thread */
+	sigfillset(&all);
+	pthread_sigmask(SIG_SETMASK, &all, &old);
+	error = pthread_create(&rec_thread, NULL, rec_writer, NULL);
+	pthread_sigmask(SIG_SETMASK, &old, NULL);
+	if (error)
+		return -1;
+
+	pthread_detach(rec_thread);
+	rec_thread_started = 1;
+
+	return 0;
+}
+
+static int rec_is_busy(void)
+{
+	int busy;
+
+	if (!rec_thread_started)
+		return 0;
+
+	pthread_mutex_lock(&rec_mutex);
+	busy = rec_busy;
+	pthread_mutex_unlock(&rec_mutex);
+
+	return busy;
+}
+
+/*
+ * Waits for a save in progress, if any, to complete.
+ */
+static void rec_wait(void)
+{
+	if (!rec_thread_started)
+		return;
+
+	pthread_mutex_lock(&rec_mutex);
+	while (rec_busy)
+		pthread_cond_wait(&rec_cond, &rec_mutex);
+	pthread_mutex_unlock(&rec_mutex);
+
+	if (rec_failed) {
+		errno = rec_errno;
+		pexit("%s: %s", rec_failed, rec_path);
+	}
+}
+
+/*
+ * Drops the file prepared for the next save.
+ */
+static void rec_discard_next(void)
+{
+	if (rec_next) {
+		fclose(rec_next);
+		rec_next = NULL;
+		unlink(rec_tmp_path);
+	}
+	*rec_path = 0;
+}
+#endif
+
+/*
+ * Writes the session state to rec_file, which is at its start.
+ */
+static void rec_write_state(void)
 {
 	int save_format;
 #if HAVE_MPI
@@ -239,7 +419,6 @@ void rec_save(void)
 #endif
 	int add_argc = 0, add_enc = 1, add_2nd_enc = 1;
 	int add_mkv_stats = (options.mkv_stats ? 1 : 0);
-	long size;
 	char **opt;
 #if HAVE_OPENCL
 	int add_lws, add_gws;
@@ -249,12 +428,6 @@ void rec_save(void)
 		 cfg_get_bool(SECTION_OPTIONS, SUBSECTION_OPENCL,
 		              "ResumeWS", 0));
 #endif
-	log_flush();
-
-	if (!rec_file) return;
-
-	if (fseek(rec_file, 0, SEEK_SET)) pexit("fseek");
-
 	/* Always save the ultimately selected format (could be eg. class or wildcard). */
 	save_format = rec_db->loaded;
 
@@ -410,6 +583,22 @@ void rec_save(void)
 		mask_save_state(rec_file);
 
 	if (ferror(rec_file)) pexit("fprintf");
+}
+
+void rec_save(void)
+{
+	long size;
+
+#if REC_ASYNC
+	rec_wait();
+#endif
+	log_flush();
+
+	if (!rec_file) return;
+
+	if (fseek(rec_file, 0, SEEK_SET)) pexit("fseek");
+
+	rec_write_state();
 
 	if ((size = ftell(rec_file)) < 0) pexit("ftell");
 	if (fflush(rec_file)) pexit("fflush");
@@ -427,6 +616,63 @@ void rec_save(void)
 	sig_reset_timer();
 }
 
+void rec_save_async(void)
+{
+#if REC_ASYNC
+	FILE *old;
+
+	if (rec_async < 0)
+		rec_async = cfg_get_bool(SECTION_OPTIONS, NULL,
+		                         "SaveInBackground", 1);
+
+	if (!rec_async || !rec_file) {
+		rec_save();
+		return;
+	}
+
+	log_write();
+
+	/* Still busy with the previous save, so try again next time */
+	if (rec_is_busy()) {
+		sig_reset_timer();
+		return;
+	}
+	rec_wait();
+
+	if (!*rec_path) {
+		strnzcpy(rec_path, path_expand(rec_name), sizeof(rec_path));
+		sprintf(rec_tmp_path, "%s.tmp", rec_path);
+	}
+
+	if (!rec_next)
+		rec_next = rec_open_next();
+	if (!rec_next || rec_start_thread()) {
+		rec_async = 0;
+		rec_save();
+		return;
+	}
+
+	old = rec_file;
+	rec_file = rec_next;
+	rec_fd = fileno(rec_file);
+	rec_next = NULL;
+
+	rec_write_state();
+
+	rec_job_new = rec_file;
+	rec_job_old = old;
+
+	pthread_mutex_lock(&rec_mutex);
+	rec_busy = 1;
+	pthread_cond_broadcast(&rec_cond);
+	pthread_mutex_unlock(&rec_mutex);
+
+	sig_reset_timer();
+#else
+	rec_save();
+#endif
+}
+
 void rec_init_hybrid(void (*save_mode)(FILE *file)) {
 	if (!rec_save_mode2)
 		rec_save_mode2 = save_mode;
@@ -437,6 +683,10 @@ void rec_init_hybrid(void (*save_mode)(FILE *file)) {
 /* See the comment in recovery.h on how the "save" parameter is used */
 void rec_done(int save)
 {
+#if REC_ASYNC
+	rec_wait();
+#endif
+
 	if (!rec_file)
 		return;
 
@@ -477,6 +727,10 @@ void rec_done(int save)
 			pexit("fclose");
 		rec_file = NULL;
 	}
+
+#if REC_ASYNC
+	rec_discard_next();
+#endif
 }
 
 static void rec_format_error(char *fn)
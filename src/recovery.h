@@ -70,6 +70,15 @@ extern void rec_init_hybrid(void (*save_mode)(FILE *file));
  */
 extern void rec_save(void);
 
+/*
+ * Same as rec_save(), but leaves syncing the files to disk to a background
+ * thread: the state goes to a new file that replaces the old one by rename(),
+ * so a crash at any point leaves one or the other in place.  Skips the save
+ * if the previous one is still in progress.  Falls back to rec_save() where
+ * threads aren't supported or SaveInBackground is disabled in john.conf.
+ */
+extern void rec_save_async(void);
+
 /*
  * Calls log_flush(), optionally calls rec_save(), optionally closes the crash
  * recovery file (which unlocks it), and finally optionally removes the file.
@@ -61,10 +61,10 @@
 volatile int event_pending = 0, event_reload = 0;
 volatile int event_abort = 0, event_help = 0, event_save = 0, event_status = 0, event_delayed_status = 0;
 volatile int event_ticksafety = 0;
-volatile int event_mpiprobe = 0, event_poll_files = 0;
+volatile int event_mpiprobe = 0, event_poll_files = 0, event_metrics = 0;
 volatile int event_fix_state = 0, event_refresh_salt = 0;
 
-volatile int timer_abort = 0, timer_status = 0;
+volatile int timer_abort = 0, timer_status = 0, timer_metrics = 0;
 static int timer_save_interval;
 #ifndef BENCH_BUILD
 static int timer_save_value;
@@ -358,6 +358,10 @@ static void sig_handle_timer(int signum)
 		timer_status = options.status_interval;
 		event_status = event_pending = 1;
 	}
+	if (timer_metrics && !--timer_metrics) {
+		timer_metrics = options.metrics_interval;
+		event_metrics = event_pending = 1;
+	}
 #else /* no OS_TIMER */
 	time = status_get_time();
 
@@ -392,6 +396,10 @@ static void sig_handle_timer(int signum)
 		timer_status += options.status_interval;
 		event_status = event_pending = 1;
 	}
+	if (timer_metrics && time >= timer_metrics) {
+		timer_metrics += options.metrics_interval;
+		event_metrics = event_pending = 1;
+	}
 #endif /* OS_TIMER */
 
 	event_fix_state = 1;
@@ -626,6 +634,8 @@ void sig_init_late(void)
 		timer_abort = time + abs(options.max_run_time);
 	if (options.status_interval)
 		timer_status = time + options.status_interval;
+	if (options.metrics_file)
+		timer_metrics = time + options.metrics_interval;
 #endif
 }
 
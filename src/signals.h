@@ -44,6 +44,7 @@ extern volatile int event_refresh_salt;	/* For defensive salt refresh every nth
 extern volatile int event_mpiprobe;	/* MPI probe for messages requested */
 #endif
 extern volatile int event_poll_files;	/* Every 3 s, poll pause/abort files */
+extern volatile int event_metrics;	/* Metrics record requested */
 extern volatile int aborted_by_timer;	/* Session was aborted by timer */
 
 /* --max-run-time timer */
@@ -52,6 +53,9 @@ extern volatile int timer_abort;
 /* --progress-every timer */
 extern volatile int timer_status;
 
+/* --metrics timer */
+extern volatile int timer_metrics;
+
 #if !OS_TIMER
 /*
  * Timer emulation for systems with no setitimer(2).
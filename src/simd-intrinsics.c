@@ -2970,3 +2970,307 @@ void SIMDSHA512full(vtype* data, uint64_t *out, uint64_t *reload_state, unsigned
 }
 
 #endif /* SIMD_PARA_SHA512 */
+
+#ifdef SIMD_COEF_64
+/*
+ * Keccak-f[1600], SIMD_COEF_64 states at once.  The states are interleaved
+ * so that lane i of state n is at state[i * SIMD_COEF_64 + n], one 64-bit
+ * element per state in each vector.
+ */
+static const uint64_t KeccakF1600RC[24] = {
+	0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+	0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+	0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+	0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+	0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+	0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+	0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+	0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+#define KECCAK_MAX_RATE		168 /* SHAKE128 */
+
+#define KECCAK_THETA(x)	  \
+	C[x] = vxor(vxor(vxor(A[x], A[x + 5]), vxor(A[x + 10], A[x + 15])), \
+	            A[x + 20])
+
+#define KECCAK_RHO_PI(b, a, r)	  \
+	B[b] = vroti_epi64(vxor(A[a], D[(a) % 5]), r)
+
+#define KECCAK_CHI(y)	  \
+	A[y + 0] = vxor(B[y + 0], vandnot(B[y + 1], B[y + 2])); \
+	A[y + 1] = vxor(B[y + 1], vandnot(B[y + 2], B[y + 3])); \
+	A[y + 2] = vxor(B[y + 2], vandnot(B[y + 3], B[y + 4])); \
+	A[y + 3] = vxor(B[y + 3], vandnot(B[y + 4], B[y + 0])); \
+	A[y + 4] = vxor(B[y + 4], vandnot(B[y + 0], B[y + 1]))
+
+static void SIMDKeccakF1600(uint64_t *state)
+{
+	vtype A[25], B[25], C[5], D[5];
+	unsigned int i, round;
+
+	for (i = 0; i < 25; i++)
+		A[i] = vload((vtype*)&state[i * SIMD_COEF_64]);
+
+	for (round = 0; round < 24; round++) {
+		KECCAK_THETA(0);
+		KECCAK_THETA(1);
+		KECCAK_THETA(2);
+		KECCAK_THETA(3);
+		KECCAK_THETA(4);
+		D[0] = vxor(C[4], vroti_epi64(C[1], 1));
+		D[1] = vxor(C[0], vroti_epi64(C[2], 1));
+		D[2] = vxor(C[1], vroti_epi64(C[3], 1));
+		D[3] = vxor(C[2], vroti_epi64(C[4], 1));
+		D[4] = vxor(C[3], vroti_epi64(C[0], 1));
+
+		B[0] = vxor(A[0], D[0]);
+		KECCAK_RHO_PI(1, 6, 44);
+		KECCAK_RHO_PI(2, 12, 43);
+		KECCAK_RHO_PI(3, 18, 21);
+		KECCAK_RHO_PI(4, 24, 14);
+		KECCAK_RHO_PI(5, 3, 28);
+		KECCAK_RHO_PI(6, 9, 20);
+		KECCAK_RHO_PI(7, 10, 3);
+		KECCAK_RHO_PI(8, 16, 45);
+		KECCAK_RHO_PI(9, 22, 61);
+		KECCAK_RHO_PI(10, 1, 1);
+		KECCAK_RHO_PI(11, 7, 6);
+		KECCAK_RHO_PI(12, 13, 25);
+		KECCAK_RHO_PI(13, 19, 8);
+		KECCAK_RHO_PI(14, 20, 18);
+		KECCAK_RHO_PI(15, 4, 27);
+		KECCAK_RHO_PI(16, 5, 36);
+		KECCAK_RHO_PI(17, 11, 10);
+		KECCAK_RHO_PI(18, 17, 15);
+		KECCAK_RHO_PI(19, 23, 56);
+		KECCAK_RHO_PI(20, 2, 62);
+		KECCAK_RHO_PI(21, 8, 55);
+		KECCAK_RHO_PI(22, 14, 39);
+		KECCAK_RHO_PI(23, 15, 41);
+		KECCAK_RHO_PI(24, 21, 2);
+
+		KECCAK_CHI(0);
+		KECCAK_CHI(5);
+		KECCAK_CHI(10);
+		KECCAK_CHI(15);
+		KECCAK_CHI(20);
+
+		A[0] = vxor(A[0], vset1_epi64(KeccakF1600RC[round]));
+	}
+
+	for (i = 0; i < 25; i++)
+		vstore((vtype*)&state[i * SIMD_COEF_64], A[i]);
+}
+
+/*
+ * XOR one block of a message into its state, padding it if it's the last.
+ */
+static MAYBE_INLINE void SIMDKeccakAbsorb(uint64_t *state, unsigned int n,
+	const unsigned char *in, unsigned int len, unsigned int rate,
+	unsigned char suffix)
+{
+	unsigned char block[KECCAK_MAX_RATE];
+	uint64_t w;
+	unsigned int i;
+
+	if (len >= rate)
+		memcpy(block, in, rate);
+	else {
+		memcpy(block, in, len);
+		memset(block + len, 0, rate - len);
+		block[len] = suffix;
+		block[rate - 1] |= 0x80;
+	}
+
+	for (i = 0; i < rate / 8; i++) {
+		memcpy(&w, block + 8 * i, 8);
+#if !ARCH_LITTLE_ENDIAN
+		w = JOHNSWAP64(w);
+#endif
+		state[i * SIMD_COEF_64 + n] ^= w;
+	}
+}
+
+static MAYBE_INLINE void SIMDKeccakSqueeze(uint64_t *state, unsigned int n,
+	unsigned char *out, unsigned int outlen)
+{
+	uint64_t w;
+	unsigned int i;
+
+	for (i = 0; i < outlen; i += 8) {
+		w = state[(i / 8) * SIMD_COEF_64 + n];
+#if !ARCH_LITTLE_ENDIAN
+		w = JOHNSWAP64(w);
+#endif
+		memcpy(out + i, &w, outlen - i < 8 ? outlen - i : 8);
+	}
+}
+
+void SIMDKeccak(const unsigned char * const *in, const int *len,
+                unsigned char * const *out, unsigned int rate,
+                unsigned int outlen, unsigned char suffix)
+{
+	JTR_ALIGN(MEM_ALIGN_SIMD) uint64_t state[25 * SIMD_COEF_64];
+	unsigned int blocks[SIMD_COEF_64], block, max_blocks = 0, n;
+
+	for (n = 0; n < SIMD_COEF_64; n++) {
+		blocks[n] = len[n] / rate + 1;
+		if (blocks[n] > max_blocks)
+			max_blocks = blocks[n];
+	}
+
+	memset(state, 0, sizeof(state));
+
+	/*
+	 * A message that is out of blocks already has its digest squeezed, so
+	 * we just let its state run along with the longer ones.
+	 */
+	for (block = 0; block < max_blocks; block++) {
+		for (n = 0; n < SIMD_COEF_64; n++)
+			if (block < blocks[n])
+				SIMDKeccakAbsorb(state, n, in[n] + block * rate,
+				                 len[n] - block * rate, rate, suffix);
+
+		SIMDKeccakF1600(state);
+
+		for (n = 0; n < SIMD_COEF_64; n++)
+			if (block == blocks[n] - 1)
+				SIMDKeccakSqueeze(state, n, out[n], outlen);
+	}
+}
+#endif /* SIMD_COEF_64 */
+
+#ifdef SIMD_COEF_64
+/*
+ * BLAKE2b, SIMD_COEF_64 messages at once, one per vector element.  The
+ * BLAKE2 reference code in blake2b_plug.c instead spreads one message's
+ * state over the vector, which leaves most of an AVX2 or AVX-512 vector
+ * idle.
+ */
+static const uint64_t Blake2bIV[8] = {
+	0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL,
+	0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+	0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+	0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+
+static const unsigned char Blake2bSigma[12][16] = {
+	{  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+	{ 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 },
+	{ 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 },
+	{  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 },
+	{  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 },
+	{  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 },
+	{ 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 },
+	{ 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 },
+	{  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 },
+	{ 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 },
+	{  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+	{ 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 }
+};
+
+#define BLAKE2B_G(a, b, c, d, x, y)	  \
+	v[a] = vadd_epi64(vadd_epi64(v[a], v[b]), m[s[x]]); \
+	v[d] = vroti_epi64(vxor(v[d], v[a]), -32); \
+	v[c] = vadd_epi64(v[c], v[d]); \
+	v[b] = vroti_epi64(vxor(v[b], v[c]), -24); \
+	v[a] = vadd_epi64(vadd_epi64(v[a], v[b]), m[s[y]]); \
+	v[d] = vroti_epi64(vxor(v[d], v[a]), -16); \
+	v[c] = vadd_epi64(v[c], v[d]); \
+	v[b] = vroti_epi64(vxor(v[b], v[c]), -63)
+
+/*
+ * Compress one block per message, with t the byte counters and f the
+ * final block flags, interleaved as for the message words.
+ */
+static void SIMDBlake2bCompress(uint64_t *state, const uint64_t *block,
+                                const uint64_t *t, const uint64_t *f)
+{
+	vtype h[8], v[16], m[16];
+	const unsigned char *s;
+	unsigned int i, round;
+
+	for (i = 0; i < 16; i++)
+		m[i] = vload((vtype*)&block[i * SIMD_COEF_64]);
+	for (i = 0; i < 8; i++) {
+		h[i] = vload((vtype*)&state[i * SIMD_COEF_64]);
+		v[i] = h[i];
+		v[i + 8] = vset1_epi64(Blake2bIV[i]);
+	}
+	v[12] = vxor(v[12], vload((vtype*)t));
+	v[14] = vxor(v[14], vload((vtype*)f));
+
+	for (round = 0; round < 12; round++) {
+		s = Blake2bSigma[round];
+		BLAKE2B_G(0, 4,  8, 12,  0,  1);
+		BLAKE2B_G(1, 5,  9, 13,  2,  3);
+		BLAKE2B_G(2, 6, 10, 14,  4,  5);
+		BLAKE2B_G(3, 7, 11, 15,  6,  7);
+		BLAKE2B_G(0, 5, 10, 15,  8,  9);
+		BLAKE2B_G(1, 6, 11, 12, 10, 11);
+		BLAKE2B_G(2, 7,  8, 13, 12, 13);
+		BLAKE2B_G(3, 4,  9, 14, 14, 15);
+	}
+
+	for (i = 0; i < 8; i++)
+		vstore((vtype*)&state[i * SIMD_COEF_64],
+		       vxor(h[i], vxor(v[i], v[i + 8])));
+}
+
+void SIMDBlake2b(const unsigned char * const *in, const int *len,
+                 unsigned char * const *out, unsigned int outlen)
+{
+	JTR_ALIGN(MEM_ALIGN_SIMD) uint64_t state[8 * SIMD_COEF_64];
+	JTR_ALIGN(MEM_ALIGN_SIMD) uint64_t block[16 * SIMD_COEF_64];
+	JTR_ALIGN(MEM_ALIGN_SIMD) uint64_t t[SIMD_COEF_64], f[SIMD_COEF_64];
+	unsigned char buf[128];
+	unsigned int blocks[SIMD_COEF_64], block_nr, max_blocks = 0, n, i;
+	uint64_t w;
+
+	for (n = 0; n < SIMD_COEF_64; n++) {
+		blocks[n] = len[n] ? (len[n] + 127) / 128 : 1;
+		if (blocks[n] > max_blocks)
+			max_blocks = blocks[n];
+		for (i = 0; i < 8; i++)
+			state[i * SIMD_COEF_64 + n] = Blake2bIV[i];
+		state[n] ^= 0x01010000 ^ outlen;
+	}
+
+	/* As for SIMDKeccak(), finished messages just run along */
+	for (block_nr = 0; block_nr < max_blocks; block_nr++) {
+		for (n = 0; n < SIMD_COEF_64; n++) {
+			unsigned int done = block_nr * 128, size = 0;
+
+			if (block_nr < blocks[n]) {
+				size = len[n] - done < 128 ? len[n] - done : 128;
+				memcpy(buf, in[n] + done, size);
+			}
+			memset(buf + size, 0, 128 - size);
+			for (i = 0; i < 16; i++) {
+				memcpy(&w, buf + 8 * i, 8);
+#if !ARCH_LITTLE_ENDIAN
+				w = JOHNSWAP64(w);
+#endif
+				block[i * SIMD_COEF_64 + n] = w;
+			}
+			t[n] = done + size;
+			f[n] = (block_nr == blocks[n] - 1) ? ~0ULL : 0;
+		}
+
+		SIMDBlake2bCompress(state, block, t, f);
+
+		for (n = 0; n < SIMD_COEF_64; n++) {
+			if (block_nr != blocks[n] - 1)
+				continue;
+			for (i = 0; i < outlen; i += 8) {
+				w = state[(i / 8) * SIMD_COEF_64 + n];
+#if !ARCH_LITTLE_ENDIAN
+				w = JOHNSWAP64(w);
+#endif
+				memcpy(out[n] + i, &w, outlen - i < 8 ? outlen - i : 8);
+			}
+		}
+	}
+}
+#endif /* SIMD_COEF_64 */
@@ -138,6 +138,24 @@ static inline void SIMDSHA512body(vtype* data, uint64_t *out, uint64_t *reload_s
 	else
 		SIMDSHA512full(data, out, reload_state, SSEi_flags);
 }
+
+/*
+ * Keccak/SHA-3 of SIMD_COEF_64 messages of any length at once: rate in bytes
+ * (136 for Keccak-256, 72 for -512), outlen at most rate, and suffix the
+ * padding's delimiter (0x01 for Keccak, 0x06 for SHA-3).
+ */
+#define KECCAK_ALGORITHM_NAME	BITS " " SIMD_TYPE " " PARA_TO_N(SIMD_COEF_64)
+void SIMDKeccak(const unsigned char * const *in, const int *len,
+                unsigned char * const *out, unsigned int rate,
+                unsigned int outlen, unsigned char suffix);
+
+/*
+ * Unkeyed BLAKE2b of SIMD_COEF_64 messages of any length at once, outlen at
+ * most 64.
+ */
+#define BLAKE2B_ALGORITHM_NAME	BITS " " SIMD_TYPE " " PARA_TO_N(SIMD_COEF_64)
+void SIMDBlake2b(const unsigned char * const *in, const int *len,
+                 unsigned char * const *out, unsigned int outlen);
 #endif
 
 #else
@@ -58,6 +58,10 @@ static int ocl_fmt;
 
 static int single_disabled_recursion;
 
+/* Keys per salt we can afford for all salts, and memory use vs. its limit */
+static int fair_count;
+static uint64_t buf_used, buf_limit;
+
 static void save_state(FILE *file)
 {
 	fprintf(file, "%d\n", rec_rule[0]);
@@ -112,30 +116,87 @@ static uint64_t calc_buf_size(int length, int min_kpc)
 	uint64_t res = sizeof(struct db_keys_hash) +
 		sizeof(struct db_keys_hash_entry) * (min_kpc - 1);
 
-	res += (sizeof(struct db_keys) - 1 + length * min_kpc);
+	res += (uint64_t)length * min_kpc;
 
-	return res * single_db->salt_count;
+	return res;
 }
 
 static void single_alloc_keys(struct db_keys **keys)
 {
-	int hash_size = sizeof(struct db_keys_hash) +
-		sizeof(struct db_keys_hash_entry) * (key_count - 1);
-
-	if (!*keys) {
-		*keys = mem_alloc_tiny(
-			sizeof(struct db_keys) - 1 + length * key_count,
-			MEM_ALIGN_WORD);
-		(*keys)->hash = mem_alloc_tiny(hash_size, MEM_ALIGN_WORD);
-	}
+	if (!*keys)
+		*keys = mem_alloc_tiny(sizeof(struct db_keys), MEM_ALIGN_WORD);
 
-	(*keys)->count = (*keys)->count_from_guesses = 0;
-	(*keys)->ptr = (*keys)->buffer;
+	(*keys)->hash = NULL;
+	(*keys)->ptr = (*keys)->buffer = NULL;
+	(*keys)->count = (*keys)->count_from_guesses = (*keys)->size = 0;
+	(*keys)->charged = 0;
 	(*keys)->have_words = 1; /* assume yes; we'll see for real later */
 	(*keys)->rule[0] = rule_number;
 	(*keys)->rule[1] = rules_stacked_number;
 	(*keys)->lock = 0;
-	memset((*keys)->hash, -1, hash_size);
+}
+
+/*
+ * Keys buffers are allocated on first use and then doubled as needed until
+ * they hold a full batch.  Every salt that has words of its own gets memory
+ * for fair_count keys reserved, which is what we can afford for all salts at
+ * once.  Growing beyond that draws from whatever is left of the buffer size
+ * limit, including memory given back by salts that ran out of words or
+ * hashes.  Once that is used up, salts just process what they have buffered.
+ */
+static uint64_t calc_keys_size(struct db_keys *keys, int size)
+{
+	int reserved = keys->have_words ? fair_count : SINGLE_HASH_MIN;
+
+	return calc_buf_size(length, MAX(size, reserved));
+}
+
+/* Sets what a salt's keys buffer is counted for in buf_used */
+static void single_charge_keys(struct db_keys *keys, uint64_t charge)
+{
+	buf_used = buf_used - keys->charged + charge;
+	keys->charged = charge;
+}
+
+static int single_grow_keys(struct db_keys *keys)
+{
+	int size = keys->size ? MIN(keys->size << 1, key_count) : SINGLE_HASH_MIN;
+	uint64_t charge;
+
+	if (keys->size < fair_count && size > fair_count)
+		size = fair_count;
+
+	charge = calc_keys_size(keys, size);
+	if (charge > keys->charged && buf_limit &&
+	    buf_used + (charge - keys->charged) > buf_limit)
+		return 0;
+
+	keys->hash = mem_realloc(keys->hash, calc_buf_size(0, size));
+	if (!keys->size)
+		memset(keys->hash->hash, -1, sizeof(keys->hash->hash));
+
+	keys->buffer = mem_realloc(keys->buffer, (size_t)length * size);
+	memset(keys->buffer + (size_t)length * keys->size, 0,
+	       (size_t)length * (size - keys->size));
+	keys->ptr = keys->buffer + (size_t)length * keys->count;
+
+	keys->size = size;
+	single_charge_keys(keys, charge);
+
+	return 1;
+}
+
+static void single_free_keys(struct db_keys *keys)
+{
+	single_charge_keys(keys, 0);
+
+	if (!keys->size)
+		return;
+
+	MEM_FREE(keys->hash);
+	MEM_FREE(keys->buffer);
+	keys->ptr = NULL;
+	keys->count = keys->count_from_guesses = keys->size = 0;
 }
 
 #undef log2
@@ -154,7 +215,7 @@ static uint32_t log2(uint32_t val)
 static void single_init(void)
 {
 	struct db_salt *salt;
-	int lim_kpc, max_buffer_GB;
+	int max_buffer_GB;
 	int64_t my_buf_share;
 
 #if HAVE_OPENCL || HAVE_ZTEX
@@ -289,24 +350,19 @@ static void single_init(void)
 	}
 
 /*
- * For large salt counts, we need to limit total memory use as well.
+ * For large salt counts, we need to limit total memory use as well.  Keys
+ * buffers grow on demand (see single_grow_keys()), but each salt needs room
+ * for at least a few keys.
  */
-	lim_kpc = key_count;
-
-	while (key_count >= 2 * SINGLE_HASH_MIN && my_buf_share &&
-	       calc_buf_size(length, key_count) > my_buf_share) {
-		if (!options.req_maxlength && length >= 32 &&
-		    (length >> 1) >= options.eff_minlength)
+	while (my_buf_share && !options.req_maxlength &&
+	       single_db->salt_count * calc_buf_size(length, SINGLE_HASH_MIN) >
+	       my_buf_share) {
+		if (length >= 32 && (length >> 1) >= options.eff_minlength)
 			length >>= 1;
-		else if (!options.req_maxlength && length > 16 &&
-		         (length - 1) >= options.eff_minlength)
+		else if (length > 16 && (length - 1) >= options.eff_minlength)
 			length--;
-#if HAVE_OPENCL
-		else if (ocl_fmt)
-			key_count -= MIN(key_count >> 1, local_work_size * ocl_v_width);
-#endif
 		else
-			key_count >>= 1;
+			break;
 	}
 
 	if (length < options.eff_maxlength) {
@@ -318,8 +374,9 @@ static void single_init(void)
 			        options.eff_maxlength,
 			        length,
 			        human_prefix(my_buf_share),
-			        human_prefix(calc_buf_size(options.eff_maxlength,
-			                                   key_count)));
+			        human_prefix(single_db->salt_count *
+			                     calc_buf_size(options.eff_maxlength,
+			                                   SINGLE_HASH_MIN)));
 		log_event(
 "- Max. length decreased from %d to %d due to buffer size limit of %sB.",
 			options.eff_maxlength,
@@ -327,63 +384,51 @@ static void single_init(void)
 			human_prefix(my_buf_share));
 	}
 
-	if (my_buf_share && calc_buf_size(length, key_count) > my_buf_share) {
+	if (my_buf_share && single_db->salt_count *
+	    calc_buf_size(length, SINGLE_HASH_MIN) > my_buf_share) {
 		if (john_main_process) {
 			fprintf(stderr,
 "Note: Can't run single mode with this many salts due to single mode buffer\n"
-"      size limit of %sB (%d keys per batch would use %sB, decreased to\n"
-"      %d for %sB). To work around this, increase SingleMaxBufferSize in\n"
-"      john.conf (if you have enough RAM) or load fewer salts at a time.\n",
+"      size limit of %sB (%sB needed for %d keys per salt). To work around\n"
+"      this, increase SingleMaxBufferSize in john.conf (if you have enough RAM)\n"
+"      or load fewer salts at a time.\n",
 			        human_prefix(my_buf_share),
-			        lim_kpc,
-			        human_prefix(calc_buf_size(length, lim_kpc)),
-			        key_count,
-			        human_prefix(calc_buf_size(length, key_count)));
+			        human_prefix(single_db->salt_count *
+			                     calc_buf_size(length, SINGLE_HASH_MIN)),
+			        SINGLE_HASH_MIN);
 		}
-		if (lim_kpc < single_db->format->params.min_keys_per_crypt)
-			log_event(
-"- Min KPC decreased further to %d (%sB), can't meet buffer size limit of %sB.",
-			key_count,
-			human_prefix(calc_buf_size(length, key_count)),
-			human_prefix(my_buf_share));
-		else
-			log_event(
-"- Min KPC decreased from %d to %d (%sB), can't meet buffer size limit of %sB.",
-			lim_kpc,
-			key_count,
-			human_prefix(calc_buf_size(length, key_count)),
+		log_event(
+"- %sB needed for %d keys per salt, can't meet buffer size limit of %sB.",
+			human_prefix(single_db->salt_count *
+			             calc_buf_size(length, SINGLE_HASH_MIN)),
+			SINGLE_HASH_MIN,
 			human_prefix(my_buf_share));
 		error();
 	}
 
-	if (key_count < lim_kpc) {
-		if (john_main_process) {
+	fair_count = key_count;
+	while (fair_count > SINGLE_HASH_MIN && my_buf_share &&
+	       single_db->salt_count * calc_buf_size(length, fair_count) >
+	       my_buf_share)
+		fair_count = MAX(fair_count >> 1, SINGLE_HASH_MIN);
+
+	if (fair_count < key_count) {
+		if (john_main_process && options.verbosity >= VERB_DEFAULT) {
 			fprintf(stderr,
-"Note: Performance for this many salts may be lower due to single mode buffer\n"
-"      size limit of %sB (%d keys per batch would use %sB, decreased to\n"
-"      %d for %sB). To work around this, ",
+"Note: Some salts may be tried in smaller batches due to single mode buffer\n"
+"      size limit of %sB (%sB needed for %d keys per salt).\n"
+"      To work around this, %sincrease SingleMaxBufferSize in john.conf.\n",
 			        human_prefix(my_buf_share),
-			        lim_kpc,
-			        human_prefix(calc_buf_size(length, lim_kpc)),
+			        human_prefix(single_db->salt_count *
+			                     calc_buf_size(length, key_count)),
 			        key_count,
-			        human_prefix(calc_buf_size(length, key_count)));
-			if (options.eff_maxlength > 8)
-				fprintf(stderr, "%s --max-length and/or ",
-				        options.req_maxlength ?
-				        "decrease" : "use");
-			fprintf(stderr,
-			        "increase%sSingleMaxBufferSize in john.conf.\n",
-			        options.eff_maxlength > 8 ? "\n      " : " ");
+			        options.eff_maxlength <= 8 ? "" :
+			        options.req_maxlength ? "decrease --max-length and/or " :
+			        "use --max-length and/or ");
 		}
-		if (lim_kpc < single_db->format->params.min_keys_per_crypt)
-			log_event(
-"- Min KPC decreased further to %d due to buffer size limit of %sB.",
-			key_count,
-			human_prefix(my_buf_share));
-		else
-			log_event(
-"- Min KPC decreased from %d to %d due to buffer size limit of %sB.",
-			lim_kpc,
+		log_event(
+"- Only %d of %d keys per salt guaranteed due to buffer size limit of %sB.",
+			fair_count,
 			key_count,
 			human_prefix(my_buf_share));
 	}
@@ -469,22 +514,26 @@ static void single_init(void)
 	rec_restore_mode(restore_state);
 	rec_init(single_db, save_state);
 
+	buf_limit = my_buf_share;
+	buf_used = 0;
+
 	salt = single_db->salts;
 	do {
 		single_alloc_keys(&salt->keys);
+		single_charge_keys(salt->keys,
+		                   calc_keys_size(salt->keys, 0));
 	} while ((salt = salt->next));
 
 	if (key_count > 1)
-		log_event("- Allocated %d buffer%s of %d candidate passwords"
-		          "%s (total %sB)",
-		          single_db->salt_count,
-		          single_db->salt_count != 1 ? "s" : "",
+		log_event("- Buffers for up to %d candidate passwords (%sB) per salt, "
+		          "grown on demand",
 		          key_count,
-		          single_db->salt_count != 1 ? " each" : "",
 		          human_prefix(calc_buf_size(length, key_count)));
 
 	guessed_keys = NULL;
 	single_alloc_keys(&guessed_keys);
+	guessed_keys->ptr = guessed_keys->buffer =
+		mem_alloc_tiny(length * key_count, MEM_ALIGN_WORD);
 
 	crk_init(single_db, NULL, guessed_keys);
 }
@@ -542,6 +591,9 @@ static int single_add_key(struct db_salt *salt, char *key, int is_from_guesses)
 		if (!(key = rules_process_stack(key, &single_rule_stack)))
 			return 0;
 
+	if (!keys->buffer && !single_grow_keys(keys))
+		return 0;
+
 /* Check if this is a known duplicate, and reject it if so */
 	if ((index = keys->hash->hash[new_hash = single_key_hash(key)]) >= 0)
 	do {
@@ -578,7 +630,8 @@ static int single_add_key(struct db_salt *salt, char *key, int is_from_guesses)
 
 	keys->count_from_guesses += is_from_guesses;
 
-	if (++(keys->count) >= key_count)
+	if (++(keys->count) >= keys->size &&
+	    (keys->size >= key_count || !single_grow_keys(keys)))
 		return single_process_buffer(salt);
 
 	return 0;
@@ -588,7 +641,8 @@ static int single_process_buffer(struct db_salt *salt)
 {
 	struct db_salt *current;
 	struct db_keys *keys;
-	size_t size;
+	char *buffer, *ptr;
+	int count;
 
 	if (retest_guessed && ++recurse_depth > max_recursion) {
 		log_event("- Disabled SingleRetestGuessed due to deep recursion");
@@ -621,28 +675,31 @@ static int single_process_buffer(struct db_salt *salt)
 	keys->ptr = keys->buffer;
 	keys->lock++;
 
+/* No hashes left for this salt, so let others have the memory */
+	if (!salt->list)
+		single_free_keys(keys);
+
 	if (retest_guessed)
-	if (guessed_keys->count) {
-		keys = mem_alloc(size = sizeof(struct db_keys) - 1 +
-			length * guessed_keys->count);
-		memcpy(keys, guessed_keys, size);
+	if ((count = guessed_keys->count)) {
+		buffer = mem_alloc(length * count);
+		memcpy(buffer, guessed_keys->buffer, length * count);
 
-		keys->ptr = keys->buffer;
+		ptr = buffer;
 		do {
 			current = single_db->salts;
 			do {
 				if (current == salt || !current->list)
 					continue;
 
-				if (single_add_key(current, keys->ptr, 1)) {
-					MEM_FREE(keys);
+				if (single_add_key(current, ptr, 1)) {
+					MEM_FREE(buffer);
 					return 1;
 				}
 			} while ((current = current->next));
-			keys->ptr += length;
-		} while (--keys->count);
+			ptr += length;
+		} while (--count);
 
-		MEM_FREE(keys);
+		MEM_FREE(buffer);
 	}
 
 	keys = salt->keys;
@@ -784,6 +841,9 @@ next:
 
 	if (!have_words) {
 		keys->have_words = 0;
+		if (keys->charged)
+			single_charge_keys(keys,
+			                   calc_keys_size(keys, keys->size));
 no_own_words:
 		if (keys->count && single_process_buffer(salt))
 			return 1;
@@ -936,6 +996,11 @@ static void single_done(void)
 		progress = 100;
 	}
 
+	if ((salt = single_db->salts))
+	do {
+		single_free_keys(salt->keys);
+	} while ((salt = salt->next));
+
 	options.eff_maxlength = orig_max_len;
 	single_db->format->params.min_keys_per_crypt = orig_min_kpc;
 
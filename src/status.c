@@ -33,6 +33,7 @@
 #include "cracker.h"
 #include "options.h"
 #include "status.h"
+#include "prof.h"
 #include "bench.h"
 #include "config.h"
 #include "unicode.h"
@@ -127,7 +128,7 @@ unsigned int status_get_time(void)
 	return status_restored_time + (status_get_raw_time() - status.start_time) / clk_tck;
 }
 
-static double status_get_timef(void)
+double status_get_timef(void)
 {
 	return status_restored_time + (double)(status_get_raw_time() - status.start_time) / clk_tck;
 }
@@ -451,6 +452,21 @@ void status_print(int level)
 		status_print_cracking(s_line, percent_value);
 #endif
 
+	if (prof_enabled && !(options.flags & FLG_STATUS_CHK)) {
+		char *p = s_line + strlen(s_line);
+
+#ifndef HAVE_MPI
+		if (options.fork)
+#else
+		if (options.fork || mpi_p > 1)
+#endif
+			p += sprintf(p, "%u ", options.node_min);
+		p += sprintf(p, "Profile: ");
+		prof_report(p, s_line + sizeof(s_line) - 1 - p,
+		            status.cands - prof_cands, "p");
+		strcat(s_line, "\n");
+	}
+
 	if (level < 2) {
 		fputs(s_line, stderr);
 		return;
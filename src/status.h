@@ -91,6 +91,11 @@ extern void status_update_cands(unsigned int cands);
  */
 extern unsigned int status_get_time(void);
 
+/*
+ * Same, with sub-second resolution.
+ */
+extern double status_get_timef(void);
+
 /*
  * Returns "now" in ticks.
  */
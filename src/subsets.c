@@ -23,8 +23,12 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <ctype.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "arch.h"
+#include "memory.h"
 #include "int128.h"
 #include "john.h"
 #include "loader.h"
@@ -43,6 +47,18 @@
 #define MAX_CAND_LENGTH PLAINTEXT_BUFFER_SIZE
 #define DEFAULT_MAX_LEN 16
 
+/*
+ * Candidates per thread and block
+ */
+#define SUBSETS_CHUNK 0x1000
+
+#if __GNUC__ >= 4 || (__GNUC__ == 3 && __GNUC_MINOR__ >= 4)
+#define lowest_bit(x) __builtin_ctz(x)
+#else
+#include <strings.h>
+#define lowest_bit(x) (ffs(x) - 1)
+#endif
+
 #if JTR_HAVE_INT128
 typedef uint128_t uint_big;
 #define UINT_BIG_MAX UINT128_MAX
@@ -54,7 +70,8 @@ typedef uint64_t uint_big;
 int subsets_cur_len;
 
 static char *charset;
-static UTF32 subset[MAX_CAND_LENGTH + 1];
+static UTF32 *charset_utf32;
+static int charcount, required, cp_max = 127;
 static int done_len[MAX_SUBSET_SIZE + 1];
 static int rec_done_len[MAX_SUBSET_SIZE + 1];
 static int charset_idx[MAX_CAND_LENGTH];
@@ -66,10 +83,37 @@ static int rec_word_len, word_len;
 static int rec_set, set;
 static int state_restored;
 static int rec_cur_len;
-static int quick_conversion;
 static uint64_t rec_num_done[MAX_CAND_LENGTH + 1];
 static uint64_t num_done[MAX_CAND_LENGTH + 1];
 static uint64_t keyspace;
+static uint64_t pair_done;
+static uint_big per_set;
+static int subsets_threads;
+static char *par_buf;
+static int key_size;
+static int *par_count;
+
+/*
+ * Position in the keyspace of the current (subset size, length) pair.  Sets
+ * are numbered in the order of their charset indices, ascending (idx[] holds
+ * them in descending order), and the words of each set in the order of their
+ * indices into the set.  Both can be numbered directly, which is what lets
+ * nodes and threads start anywhere in the keyspace.
+ */
+struct subsets_pos {
+	uint64_t set;
+	uint_big word_num;
+	int idx[MAX_SUBSET_SIZE];
+	UTF32 chars[MAX_SUBSET_SIZE];
+	int quick;
+	unsigned char word[MAX_CAND_LENGTH];
+	unsigned char count[MAX_SUBSET_SIZE];
+};
+
+static struct subsets_pos cur_pos, *par_pos, *feed_pos;
+static int feed_index;
+
+static void pos_advance(struct subsets_pos *p, uint_big n, int k, int len);
 
 static double get_progress(void)
 {
@@ -95,6 +139,24 @@ static void fix_state(void)
 	rec_cur_len = subsets_cur_len;
 	for (i = 0; i <= maxlength; i++)
 		rec_num_done[i] = num_done[i];
+
+	/*
+	 * While feeding a block, resume from the start of the set holding the
+	 * last candidate handed over.
+	 */
+	if (feed_pos) {
+		struct subsets_pos p, *cur = feed_pos;
+
+		if (feed_index >= per_set - feed_pos->word_num) {
+			p = *feed_pos;
+			pos_advance(&p, feed_index, num_comb, word_len);
+			cur = &p;
+		}
+		rec_set = cur->set;
+		for (i = 0; i < rec_num_comb; i++)
+			rec_charset_idx[i] = cur->idx[i];
+		rec_num_done[word_len] = pair_done + cur->set * per_set;
+	}
 }
 
 static void save_state(FILE *file)
@@ -349,101 +411,344 @@ static uint64_t numwords(uint32_t k, uint32_t n, uint32_t len, uint32_t r)
 	}
 }
 
-static int submit(UTF32 *subset)
+/*
+ * Number of ways to complete a word with m more characters when u of the
+ * subset's k characters are still missing from it.
+ */
+static uint_big completions[MAX_CAND_LENGTH + 1][MAX_SUBSET_SIZE + 1];
+
+static void init_completions(int k, int len)
+{
+	int m, u;
+
+	memset(completions, 0, sizeof(completions));
+	completions[0][0] = 1;
+	for (m = 1; m <= len; m++) {
+		completions[m][0] = k * completions[m - 1][0];
+		for (u = 1; u <= k; u++)
+			completions[m][u] = (k - u) * completions[m - 1][u] +
+				u * completions[m - 1][u - 1];
+	}
+}
+
+static void set_chars(struct subsets_pos *p, int k)
 {
-	UTF8 out[4 * MAX_CAND_LENGTH];
 	int i;
 
-	/* Set current word */
-	if (quick_conversion) {
-		/* Quick conversion (only ASCII or ISO-8859-1) */
-		for (i = 0; i < word_len; i++)
-			out[i] = subset[i];
-		out[i] = 0;
-	} else if (options.target_enc == UTF_8) {
-		/* Nearly as quick conversion, from UTF-8-32[tm] to UTF-8 */
-		subset[word_len] = 0;
-		utf8_32_to_utf8(out, subset);
-		out[maxlength] = 0;
-	} else {
-		/* Slowest conversion, from real UTF-32 to some legacy codepage */
-		subset[word_len] = 0;
-		utf32_to_enc(out, sizeof(out), subset);
+	p->quick = 1;
+	for (i = 0; i < k; i++)
+		if ((p->chars[i] = charset_utf32[p->idx[i]]) > cp_max)
+			p->quick = 0;
+}
+
+/* Set p to set number n */
+static void set_unrank(struct subsets_pos *p, uint64_t n, int k)
+{
+	int i, c = 0;
+
+	p->set = n;
+	for (i = k - 1; i >= 0; i--, c++) {
+		uint64_t w;
+
+		while (n >= (w = numsets(charcount - c - 1, i, 0))) {
+			n -= w;
+			c++;
+		}
+		p->idx[i] = c;
 	}
+	set_chars(p, k);
+}
 
-	if (options.flags & FLG_MASK_CHK)
-		return do_mask_crack((char*)out);
-	else
-		return crk_process_key((char*)out);
+static uint64_t set_rank(const int *idx, int k)
+{
+	uint64_t n = 0;
+	int i, c = 0;
+
+	for (i = k - 1; i >= 0; i--, c++)
+		for (; c < idx[i]; c++)
+			n += numsets(charcount - c - 1, i, 0);
+
+	return n;
 }
 
-static void swap(UTF32 *x, UTF32 *y)
+/* Next set, returns 0 if there's none */
+static int set_next(struct subsets_pos *p, int k)
 {
-	int temp;
+	int i = 0;
+
+	do {
+		int b;
+
+		while (i < k && ++p->idx[i] >= charcount)
+			++i;
+
+		if (required && p->idx[k - 1] >= required)
+			i = k;
+
+		if (i >= k)
+			return 0;
+
+		b = i;
+		while (--i >= 0)
+		if ((p->idx[i] = p->idx[i + 1] + 1) >= charcount) {
+			i = b + 1;
+			break;
+		}
+	} while (i >= 0);
+
+	p->set++;
+	set_chars(p, k);
 
-	temp = *x;
-	*x = *y;
-	*y = temp;
+	return 1;
 }
 
+/* Set p to word number n of its set */
+static void word_unrank(struct subsets_pos *p, uint_big n, int k, int len)
+{
+	int i, c, missing = k;
+
+	p->word_num = n;
+	memset(p->count, 0, sizeof(p->count));
+	for (i = 0; i < len; i++) {
+		for (c = 0; c < k; c++) {
+			uint_big w = completions[len - i - 1][missing - !p->count[c]];
+
+			if (n < w)
+				break;
+			n -= w;
+		}
+		p->word[i] = c;
+		if (!p->count[c]++)
+			missing--;
+	}
+}
 
-static int permute(UTF32 *a, int i, int n)
+/*
+ * Next word of the same set.  Returns the first position that changed, or -1
+ * if there's no next word.
+ */
+static int word_next(struct subsets_pos *p, int k, int len)
 {
-	int j;
+	unsigned int absent = 0, higher;
+	int i, c, first, missing = 0;
+
+	/* Plain permutation: the usual next one in lexical order */
+	if (k == len) {
+		unsigned char *w = p->word;
+		int j;
+
+		for (i = len - 2; i >= 0 && w[i] > w[i + 1]; i--)
+			;
+		if (i < 0)
+			return -1;
+		for (j = len - 1; w[j] < w[i]; j--)
+			;
+		c = w[i]; w[i] = w[j]; w[j] = c;
+		for (first = i++, j = len - 1; i < j; i++, j--) {
+			c = w[i]; w[i] = w[j]; w[j] = c;
+		}
+		p->word_num++;
+		return first;
+	}
 
-	if (i >= n - 1)
-		return submit(a);
+	/* absent is the set characters missing from word[0..i) */
+	for (i = len - 1; i >= 0; i--) {
+		c = p->word[i];
+		if (!--p->count[c]) {
+			absent |= 1U << c;
+			missing++;
+		}
 
-	for (j = i; j < n; j++) {
-		swap(&a[i], &a[j]);
-		if (permute(a, i + 1, n))
-			return 1;
-		swap(&a[i], &a[j]);
+		/* Smallest larger character we can still complete the word with */
+		if (missing < len - i) {
+			if (++c >= k)
+				continue;
+		} else if (missing == len - i && (higher = absent & (~1U << c)))
+			c = lowest_bit(higher);
+		else
+			continue;
+
+		p->word[i] = c;
+		if (!p->count[c]++) {
+			absent &= ~(1U << c);
+			missing--;
+		}
+		first = i;
+
+		/* Smallest completion */
+		while (++i < len) {
+			c = missing < len - i ? 0 : lowest_bit(absent);
+			p->word[i] = c;
+			if (!p->count[c]++) {
+				absent &= ~(1U << c);
+				missing--;
+			}
+		}
+
+		p->word_num++;
+		return first;
 	}
 
-	return 0;
+	return -1;
 }
 
-static int unique(UTF32 *a, int start, int index)
+/* Move p n words ahead, which must not take it past the keyspace */
+static void pos_advance(struct subsets_pos *p, uint_big n, int k, int len)
 {
-	int i;
+	uint_big sets;
 
-	for (i = start; i < index; i++)
-		if (a[i] == a[index])
-			return 0;
-	return 1;
+	if (n < per_set - p->word_num) {
+		word_unrank(p, p->word_num + n, k, len);
+		return;
+	}
+
+	n -= per_set - p->word_num;
+	sets = n / per_set + 1;
+	if (sets < 64) {
+		while (sets--)
+			set_next(p, k);
+	} else
+		set_unrank(p, p->set + sets, k);
+	word_unrank(p, n % per_set, k, len);
 }
 
-static int permute_dupe(UTF32 *a, int i, int n)
+/*
+ * Generate count words from p onwards into buf, leaving p at the next one.
+ * Only the positions that changed since the previous word are converted.
+ */
+static void gen_words(struct subsets_pos *pos, int k, int len,
+	char *buf, int count)
 {
-	int j;
+	struct subsets_pos p = *pos;
+	uint64_t quick[(MAX_CAND_LENGTH + 7) / 8] = { 0 };
+	UTF32 word[MAX_CAND_LENGTH + 1];
+	UTF8 out[4 * MAX_CAND_LENGTH];
+	int i, from = 0, last = len - 1;
+
+	while (count > 0) {
+		if (p.quick) {
+			int c = p.word[last], run = 1, n;
+
+			/*
+			 * Quick conversion (only ASCII or ISO-8859-1), kept in 64-bit
+			 * lanes so it can be stored to the buffer a lane at a time.
+			 */
+			for (i = from; i < len; i++) {
+#if ARCH_LITTLE_ENDIAN
+				int shift = (i & 7) * 8;
+#else
+				int shift = (7 - (i & 7)) * 8;
+#endif
+				quick[i / 8] = (quick[i / 8] & ~(0xffULL << shift)) |
+					(uint64_t)p.chars[p.word[i]] << shift;
+			}
 
-	if (i >= n - 1)
-		return submit(a);
+			/*
+			 * While the rest of the word holds all of the set, the last
+			 * character just runs through the remaining ones.
+			 */
+			if (p.count[c] > 1 && (run = k - c) > count)
+				run = count;
+			for (n = 0; n < run; n++) {
+				for (i = 0; i < len; i += 8)
+					memcpy(buf + i, &quick[i / 8], 8);
+				buf[last] = p.chars[c + n];
+				buf[len] = 0;
+				buf += key_size;
+			}
+			if (run > 1) {
+				p.count[c]--;
+				p.count[c + run - 1]++;
+				p.word[last] = c + run - 1;
+				p.word_num += run - 1;
+			}
+			count -= run;
+		} else {
+			for (i = from; i < len; i++)
+				word[i] = p.chars[p.word[i]];
+			word[len] = 0;
+			if (options.target_enc == UTF_8) {
+				/* Nearly as quick, from UTF-8-32[tm] to UTF-8 */
+				utf8_32_to_utf8(out, word);
+				out[maxlength] = 0;
+			} else {
+				/* Slowest, from real UTF-32 to a legacy codepage */
+				utf32_to_enc(out, sizeof(out), word);
+			}
+			strnzcpy(buf, (char*)out, maxlength + 1);
+			buf += key_size;
+			count--;
+		}
 
-	for (j = i; j < n; j++) {
-		if (unique(a, i, j)) {
-			swap(&a[i], &a[j]);
-			if (permute_dupe(a, i + 1, n))
-				return 1;
-			swap(&a[i], &a[j]);
+		if ((from = word_next(&p, k, len)) < 0) {
+			from = 0;
+			if (set_next(&p, k))
+				word_unrank(&p, 0, k, len);
 		}
 	}
 
-	return 0;
+	*pos = p;
 }
 
-static int expand(UTF32 *a, int setlen, int outlen, int base)
+/*
+ * Try words start to end - 1 of the current pair, generating them in chunks
+ * using our threads.  Returns non-zero if we should stop.
+ */
+static int try_words(int k, int len, uint_big start, uint_big end)
 {
-	int j;
 
-	if (setlen == outlen)
-		return permute_dupe(a, 0, outlen);
+	set_unrank(&cur_pos, (uint64_t)(start / per_set), k);
+	word_unrank(&cur_pos, start % per_set, k, len);
 
-	for (j = base; j < num_comb; j++) {
-		a[setlen] = a[j];
-		if (expand(a, setlen + 1, outlen, j))
-			return 1;
+	while (start < end) {
+		int t, count = 0;
+
+		/* Chunk starts */
+		for (t = 0; t < subsets_threads; t++) {
+			uint_big first = start + (uint_big)t * SUBSETS_CHUNK;
+
+			if (first >= end)
+				break;
+			par_count[t] = end - first < SUBSETS_CHUNK ?
+				(int)(end - first) : SUBSETS_CHUNK;
+			if (t) {
+				par_pos[t] = par_pos[t - 1];
+				pos_advance(&par_pos[t], SUBSETS_CHUNK, k, len);
+			} else
+				par_pos[t] = cur_pos;
+			count++;
+		}
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(subsets_threads)
+#endif
+		for (t = 0; t < count; t++) {
+			struct subsets_pos p = par_pos[t];
+
+			gen_words(&p, k, len,
+			          par_buf + (size_t)t * SUBSETS_CHUNK * key_size,
+			          par_count[t]);
+			if (t == count - 1)
+				cur_pos = p;
+		}
+
+		for (t = 0; t < count; t++) {
+			char *key = par_buf + (size_t)t * SUBSETS_CHUNK * key_size;
+
+			feed_pos = &par_pos[t];
+			for (feed_index = 0; feed_index < par_count[t];
+			     feed_index++, key += key_size) {
+				if (options.flags & FLG_MASK_CHK) {
+					if (do_mask_crack(key))
+						return 1;
+				} else if (crk_process_key(key))
+					return 1;
+			}
+			feed_pos = NULL;
+
+			start += par_count[t];
+			num_done[len] = pair_done + start;
+		}
 	}
 
 	return 0;
@@ -451,14 +756,13 @@ static int expand(UTF32 *a, int setlen, int outlen, int base)
 
 int do_subsets_crack(struct db_main *db, char *req_charset)
 {
-	int i, cp_max = 127;
-	int charcount;
+	int i;
 	int fmt_case = (db->format->params.flags & FMT_CASE);
 	char *default_set;
-	UTF32 *charset_utf32;
-	int required = options.subset_must;
 	int min_comb = options.subset_min_diff;
 
+	required = options.subset_must;
+
 	maxlength = MIN(MAX_CAND_LENGTH, options.eff_maxlength);
 
 	if (!options.req_maxlength)
@@ -578,6 +882,14 @@ int do_subsets_crack(struct db_main *db, char *req_charset)
 		}
 	}
 
+#ifdef _OPENMP
+	if ((subsets_threads = cfg_get_int(SECTION_OPTIONS, NULL,
+	                                   "SubsetsThreads")) <= 0)
+		subsets_threads = omp_get_max_threads();
+#else
+	subsets_threads = 1;
+#endif
+
 	if (john_main_process) {
 		int len;
 		uint64_t total_keyspace = 0;
@@ -603,6 +915,9 @@ int do_subsets_crack(struct db_main *db, char *req_charset)
 		          word_len, maxlength, maxdiff);
 		if (required)
 			log_event("- Required set: First %d of charset", required);
+		if (subsets_threads > 1)
+			log_event("- Generating candidates using %d threads",
+			          subsets_threads);
 		if (total_keyspace)
 			log_event("- Total keyspace: %" PRIu64, total_keyspace);
 		else
@@ -630,15 +945,19 @@ int do_subsets_crack(struct db_main *db, char *req_charset)
 		}
 	}
 
+	key_size = (maxlength + 8) & ~7;
+	par_buf = mem_alloc((size_t)subsets_threads * SUBSETS_CHUNK * key_size);
+	par_pos = mem_alloc(subsets_threads * sizeof(*par_pos));
+	par_count = mem_alloc(subsets_threads * sizeof(*par_count));
+
 	crk_init(db, fix_state, NULL);
 
 	/* Iterate over subset sizes and output lengths */
 	while (num_comb <= maxdiff && word_len <= maxlength) {
-		int target = MIN(num_comb, word_len);
 		uint64_t num_sets = numsets(charcount, num_comb, required);
 		uint64_t num_words = numwords(num_comb, charcount, word_len, required);
 		uint64_t num_per_set = num_words / num_sets;
-		int bail = 0;
+		uint_big total, start, end;
 
 		if (options.verbosity >= VERB_DEFAULT)
 		log_event("- Subset size %d, word length %d (%"PRIu64" sets x %"PRIu64
@@ -649,79 +968,40 @@ int do_subsets_crack(struct db_main *db, char *req_charset)
 			/* Initialize first subset */
 			for (i = 0; i < num_comb; i++)
 				charset_idx[num_comb - i - 1] = i;
+			set = 0;
 		}
 
-		/* Iterate over subsets for this size */
-		while (1) {
-			int skip = 0;
-
-			if (state_restored)
-				state_restored = 0;
-			else
-				set++;
-
-			if (options.node_count) {
-				int for_node = set % options.node_count + 1;
-				skip = for_node < options.node_min ||
-					for_node > options.node_max;
-			}
-
-			if (!skip) {
-				/* Set current subset */
-				quick_conversion = 1;
-				for (i = 0; i < num_comb; i++) {
-					if ((subset[i] = charset_utf32[charset_idx[i]]) > cp_max)
-						quick_conversion = 0;
-				}
-
-				/* Create all words for this subset and length */
-				if (word_len > num_comb) {
-					if (expand(subset, num_comb, word_len, 0)) {
-						bail = 1;
-						break;
-					}
-				} else {
-					if (permute(subset, 0, word_len)) {
-						bail = 1;
-						break;
-					}
-				}
-			}
-
-			num_done[word_len] += num_per_set;
-
-			if (bail || num_comb == charcount)
-				break;
-
-			/* Next subset of this size */
-			i = 0;
-			do {
-				int b;
-
-				while (i < target && ++charset_idx[i] >= charcount)
-					++i;
+		init_completions(num_comb, word_len);
+		per_set = completions[word_len][num_comb];
+		total = (uint_big)num_sets * per_set;
+		start = 0;
+		end = total;
 
-				if (required && charset_idx[num_comb - 1] >= required)
-					i = num_comb;
+		/* Split the pair's candidates evenly between nodes */
+		if (options.node_count) {
+			uint_big share = total / options.node_count;
+			uint_big rem = total % options.node_count;
 
-				if (i >= num_comb)
-					break;
+			start = share * (options.node_min - 1) +
+				MIN(options.node_min - 1, rem);
+			end = share * options.node_max + MIN(options.node_max, rem);
+		}
 
-				b = i;
-				while (--i >= 0)
-				if ((charset_idx[i] = charset_idx[i + 1] + 1) >= charcount) {
-					i = b + 1;
-					break;
-				}
-			} while (i >= 0);
+		if (state_restored) {
+			uint_big resume = set_rank(charset_idx, num_comb) * per_set;
 
-			if (i >= num_comb)
-				break;
-		}
+			pair_done = num_done[word_len] - resume;
+			if (start < resume)
+				start = resume;
+			state_restored = 0;
+		} else
+			pair_done = num_done[word_len];
 
-		if (bail)
+		if (start < end && try_words(num_comb, word_len, start, end))
 			break;
 
+		num_done[word_len] = pair_done + total;
+
 		done_len[num_comb] = word_len;
 
 		for (i = min_comb; i <= maxdiff; i++)
@@ -805,6 +1085,9 @@ int do_subsets_crack(struct db_main *db, char *req_charset)
 	crk_done();
 	rec_done(event_abort);
 
+	MEM_FREE(par_count);
+	MEM_FREE(par_pos);
+	MEM_FREE(par_buf);
 	MEM_FREE(charset_utf32);
 
 	return 0;
@@ -12,6 +12,7 @@
 #include "logger.h"
 #include "options.h"
 #include "status.h"
+#include "prof.h"
 #include "suppressor.h"
 
 #define DEFAULT_SIZE 256 /* MiB */
@@ -130,7 +131,11 @@ static MAYBE_INLINE uint32_t key_hash(const char *key, uint64_t *hash2)
 static int suppressor_process_key(char *key)
 {
 	uint64_t hash;
-	unsigned int i, j;
+	unsigned int i, j, prof_prev = 0;
+	int timed = prof_enabled && prof_sample(PROF_SUPPRESSOR);
+
+	if (timed)
+		prof_prev = prof_switch(PROF_SUPPRESSOR);
 
 	i = ((uint64_t)key_hash(key, &hash) * N) >> 32;
 
@@ -142,6 +147,8 @@ static int suppressor_process_key(char *key)
 				filter[i][j + 1] = hash; /* postpone eviction of this hash */
 			}
 			status.suppressor_hit++;
+			if (timed)
+				prof_switch(prof_prev);
 			return 0;
 		}
 	}
@@ -169,5 +176,8 @@ static int suppressor_process_key(char *key)
 			suppressor_done();
 	}
 
+	if (timed)
+		prof_switch(prof_prev);
+
 	return old_process_key(key);
 }
@@ -0,0 +1,848 @@
+/*
+ * This file is part of John the Ripper password cracker.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted.
+ *
+ * There's ABSOLUTELY NO WARRANTY, express or implied.
+ */
+
+/* Differential tests and micro-benchmarks for simd-intrinsics.c
+ *
+ * Every lane of every SSEi_flags variant we exercise (interleaved or flat
+ * input, one or two blocks with or without SSEi_RELOAD, input-format or flat
+ * output, and the SHA-512 half-block and loop entry points) is checked
+ * against the scalar hash of a random message of suitable length.  Then each
+ * variant is timed and reported per block and lane, next to the scalar code
+ * doing the same number of blocks, so SIMD_PARA choices and new kernels can
+ * be compared.  On x86 the figures are TSC cycles, elsewhere nanoseconds.
+ */
+
+#include "../simd-intrinsics.h"
+#include "../md4.h"
+#include "../md5.h"
+#include "../sha.h"
+#include "../blake2.h"
+#include "../KeccakHash.h"
+
+#if SIMD_COEF_32
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define SIMD_TICKS()		__rdtsc()
+#define SIMD_TICK_UNIT		"cycles"
+#else
+#define SIMD_TICKS()		((uint64_t)clock() * (1000000000 / CLOCKS_PER_SEC))
+#define SIMD_TICK_UNIT		"ns"
+#endif
+
+/* Minimum run time of each benchmark, in clock() ticks */
+#define SIMD_BENCH_TIME		(CLOCKS_PER_SEC / 50)
+
+/* Iterations for the SHA-512 loop entry points */
+#define SIMD_LOOP_COUNT		3
+
+static uint32_t simd_seed = 0x12345678;
+
+static uint32_t simd_random(void)
+{
+	simd_seed ^= simd_seed << 13;
+	simd_seed ^= simd_seed >> 17;
+	simd_seed ^= simd_seed << 5;
+
+	return simd_seed;
+}
+
+/*
+ * Builds the padded blocks for a message: 0x80, zeros and the bit length,
+ * little or big endian, in the last 8 bytes of a 64 byte block or the last
+ * 16 bytes of a 128 byte one.
+ */
+static void simd_pad(unsigned char *buf, const unsigned char *msg, size_t len,
+	size_t block_size, int blocks, int big_endian)
+{
+	uint64_t bits = (uint64_t)len << 3;
+	size_t end = block_size * blocks;
+	int i;
+
+	memset(buf, 0, end);
+	memcpy(buf, msg, len);
+	buf[len] = 0x80;
+	for (i = 0; i < 8; i++) {
+		if (big_endian)
+			buf[end - 1 - i] = bits >> (8 * i);
+		else
+			buf[end - 8 + i] = bits >> (8 * i);
+	}
+}
+
+static uint32_t simd_get32(const unsigned char *p, int big_endian)
+{
+	if (big_endian)
+		return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 |
+			(uint32_t)p[2] << 8 | p[3];
+	return (uint32_t)p[3] << 24 | (uint32_t)p[2] << 16 |
+		(uint32_t)p[1] << 8 | p[0];
+}
+
+static void simd_put32(unsigned char *p, uint32_t v, int big_endian)
+{
+	int i;
+
+	for (i = 0; i < 4; i++)
+		p[big_endian ? 3 - i : i] = v >> (8 * i);
+}
+
+static uint64_t simd_get64(const unsigned char *p)
+{
+	return (uint64_t)simd_get32(p, 1) << 32 | simd_get32(p + 4, 1);
+}
+
+static void simd_put64(unsigned char *p, uint64_t v)
+{
+	simd_put32(p, v >> 32, 1);
+	simd_put32(p + 4, (uint32_t)v, 1);
+}
+
+/* Index of word j of a lane in an interleaved buffer of stride words */
+#define SIMD_IDX(lane, j, stride, coef) \
+	(((lane) / (coef) * (stride) + (j)) * (coef) + (lane) % (coef))
+
+static void simd_error(const char *variant, int lane, const unsigned char *msg,
+	size_t len, const unsigned char *expected, const unsigned char *computed,
+	int size)
+{
+	failed = 0;
+	inc_failed_test();
+	printf("%s %s lane %d failed.\n", Results.test_name, variant, lane);
+	printf("   input    : %s\n", packedhex(msg, len));
+	printf("   Expected : %s\n", packedhex(expected, size));
+	printf("   Computed : %s\n", packedhex(computed, size));
+}
+
+static void simd_report(const char *name, const char *variant, double ticks,
+	double scalar)
+{
+	printf("    %-18s %-15s %8.2f %s/block", name, variant, ticks,
+	       SIMD_TICK_UNIT);
+	if (scalar > 0 && ticks > 0)
+		printf("  %6.2fx scalar", scalar / ticks);
+	putchar('\n');
+}
+
+/*
+ * Scalar references, over a whole message or over a number of blocks.
+ */
+#define SIMD_REF(name, ctx, init, update, final)			\
+static void simd_ref_##name(unsigned char *digest,			\
+	const unsigned char *msg, size_t len)				\
+{									\
+	ctx c;								\
+									\
+	init(&c);							\
+	update(&c, msg, len);						\
+	final(digest, &c);						\
+}									\
+									\
+static void simd_ref_blocks_##name(const unsigned char *buf,		\
+	size_t size, unsigned int count)				\
+{									\
+	unsigned char digest[64];					\
+	ctx c;								\
+									\
+	init(&c);							\
+	while (count--)							\
+		update(&c, buf, size);					\
+	final(digest, &c);						\
+}
+
+SIMD_REF(md4, MD4_CTX, MD4_Init, MD4_Update, MD4_Final)
+SIMD_REF(md5, MD5_CTX, MD5_Init, MD5_Update, MD5_Final)
+SIMD_REF(sha1, SHA_CTX, SHA1_Init, SHA1_Update, SHA1_Final)
+SIMD_REF(sha224, SHA256_CTX, SHA224_Init, SHA256_Update, SHA224_Final)
+SIMD_REF(sha256, SHA256_CTX, SHA256_Init, SHA256_Update, SHA256_Final)
+SIMD_REF(sha384, SHA512_CTX, SHA384_Init, SHA512_Update, SHA384_Final)
+SIMD_REF(sha512, SHA512_CTX, SHA512_Init, SHA512_Update, SHA512_Final)
+
+/*
+ * Scalar time per block, hashing buffers of block_size * 64 bytes.
+ */
+static double simd_bench_scalar(void (*ref)(const unsigned char *, size_t,
+	unsigned int), size_t block_size)
+{
+	unsigned char *buf = mem_calloc(64, block_size);
+	unsigned int count = 1;
+	uint64_t ticks;
+	clock_t start;
+
+	do {
+		count <<= 1;
+		start = clock();
+		ticks = SIMD_TICKS();
+		ref(buf, block_size * 64, count);
+		ticks = SIMD_TICKS() - ticks;
+	} while (clock() - start < SIMD_BENCH_TIME);
+
+	MEM_FREE(buf);
+
+	return (double)ticks / (64.0 * count);
+}
+
+/*
+ * MD4, MD5, SHA-1, SHA-224 and SHA-256: 32-bit words, 64 byte blocks.
+ */
+typedef void (*simd_body32)(void *data, uint32_t *out, uint32_t *reload,
+	unsigned SSEi_flags);
+
+struct simd_hash32 {
+	const char *name;
+	simd_body32 body;
+	void (*ref)(unsigned char *, const unsigned char *, size_t);
+	void (*ref_blocks)(const unsigned char *, size_t, unsigned int);
+	unsigned int para, state_words, digest_size, flags;
+	int big_endian, flat_out;
+};
+
+enum {
+	SIMD32_MIXED,
+	SIMD32_FLAT,
+	SIMD32_FLAT_OUT,
+	SIMD32_RELOAD,
+	SIMD32_INP_FMT,
+	SIMD32_2BUF,
+	SIMD32_VARIANTS
+};
+
+static const char *simd32_variant[SIMD32_VARIANTS] = {
+	"mixed", "flat", "flat-out", "reload", "reload-inp-fmt", "flat-2buf"
+};
+
+struct simd_bufs32 {
+	unsigned int lanes;
+	unsigned char (*msg)[128];
+	size_t *len;
+	uint32_t *mixed[2], *tmp, *out;
+	unsigned char *flat;
+};
+
+static int simd32_blocks(int variant)
+{
+	return variant >= SIMD32_RELOAD ? 2 : 1;
+}
+
+static void simd32_alloc(struct simd_bufs32 *b, const struct simd_hash32 *h)
+{
+	b->lanes = SIMD_COEF_32 * h->para;
+	b->msg = mem_alloc(b->lanes * sizeof(*b->msg));
+	b->len = mem_alloc(b->lanes * sizeof(*b->len));
+	b->mixed[0] = mem_alloc_align(b->lanes * 64, MEM_ALIGN_SIMD);
+	b->mixed[1] = mem_alloc_align(b->lanes * 64, MEM_ALIGN_SIMD);
+	b->tmp = mem_alloc_align(b->lanes * 64, MEM_ALIGN_SIMD);
+	b->out = mem_alloc_align(b->lanes * 64, MEM_ALIGN_SIMD);
+	b->flat = mem_alloc_align(b->lanes * 128, MEM_ALIGN_SIMD);
+}
+
+static void simd32_free(struct simd_bufs32 *b)
+{
+	MEM_FREE(b->msg);
+	MEM_FREE(b->len);
+	MEM_FREE(b->mixed[0]);
+	MEM_FREE(b->mixed[1]);
+	MEM_FREE(b->tmp);
+	MEM_FREE(b->out);
+	MEM_FREE(b->flat);
+}
+
+/*
+ * Random messages for all lanes, laid out for the variant.  Flat input has
+ * the length words of a last block as host integers, not as bytes.
+ */
+static void simd32_fill(struct simd_bufs32 *b, const struct simd_hash32 *h,
+	int variant)
+{
+	int blocks = simd32_blocks(variant);
+	size_t stride = variant == SIMD32_2BUF ? 128 : 64;
+	unsigned int lane, i, j;
+
+	for (lane = 0; lane < b->lanes; lane++) {
+		unsigned char padded[128];
+		uint32_t *last;
+
+		b->len[lane] = blocks == 1 ? simd_random() % 56 :
+			56 + simd_random() % 64;
+		for (i = 0; i < b->len[lane]; i++)
+			b->msg[lane][i] = simd_random();
+		simd_pad(padded, b->msg[lane], b->len[lane], 64, blocks,
+		         h->big_endian);
+
+		for (i = 0; i < blocks; i++)
+			for (j = 0; j < 16; j++)
+				b->mixed[i][SIMD_IDX(lane, j, 16, SIMD_COEF_32)] =
+					simd_get32(&padded[64 * i + 4 * j],
+					           h->big_endian);
+
+		memcpy(&b->flat[stride * lane], padded, 64 * blocks);
+		last = (uint32_t*)&b->flat[stride * lane + 64 * (blocks - 1)];
+		last[14] = simd_get32(&padded[64 * blocks - 8], h->big_endian);
+		last[15] = simd_get32(&padded[64 * blocks - 4], h->big_endian);
+	}
+}
+
+static void simd32_run(struct simd_bufs32 *b, const struct simd_hash32 *h,
+	int variant)
+{
+	unsigned int f = h->flags;
+
+	switch (variant) {
+	case SIMD32_MIXED:
+		h->body(b->mixed[0], b->out, NULL, f);
+		break;
+	case SIMD32_FLAT:
+		h->body(b->flat, b->out, NULL, f | SSEi_FLAT_IN);
+		break;
+	case SIMD32_FLAT_OUT:
+		h->body(b->mixed[0], b->out, NULL, f | SSEi_FLAT_OUT);
+		break;
+	case SIMD32_RELOAD:
+		h->body(b->mixed[0], b->out, NULL, f);
+		h->body(b->mixed[1], b->out, b->out, f | SSEi_RELOAD);
+		break;
+	case SIMD32_INP_FMT:
+		h->body(b->mixed[0], b->tmp, NULL, f | SSEi_OUTPUT_AS_INP_FMT);
+		h->body(b->mixed[1], b->out, b->tmp, f | SSEi_RELOAD_INP_FMT);
+		break;
+	case SIMD32_2BUF:
+		h->body(b->flat, b->out, NULL,
+		        f | SSEi_FLAT_IN | SSEi_2BUF_INPUT_FIRST_BLK);
+		h->body(b->flat + 64, b->out, b->out,
+		        f | SSEi_FLAT_IN | SSEi_2BUF_INPUT | SSEi_RELOAD);
+		break;
+	}
+}
+
+static void simd32_check(struct simd_bufs32 *b, const struct simd_hash32 *h,
+	int variant)
+{
+	unsigned char expected[32], computed[32];
+	unsigned int lane, j;
+
+	for (lane = 0; lane < b->lanes; lane++) {
+		inc_test();
+		h->ref(expected, b->msg[lane], b->len[lane]);
+		if (variant == SIMD32_FLAT_OUT)
+			memcpy(computed, &b->out[lane * h->state_words],
+			       h->digest_size);
+		else
+			for (j = 0; j < h->state_words; j++)
+				simd_put32(&computed[4 * j], b->out[SIMD_IDX(lane, j,
+				           h->state_words, SIMD_COEF_32)],
+				           h->big_endian);
+		if (memcmp(expected, computed, h->digest_size))
+			simd_error(simd32_variant[variant], lane, b->msg[lane],
+			           b->len[lane], expected, computed,
+			           h->digest_size);
+	}
+}
+
+static double simd32_bench(struct simd_bufs32 *b, const struct simd_hash32 *h,
+	int variant)
+{
+	unsigned int count = 1, i;
+	uint64_t ticks;
+	clock_t start;
+
+	do {
+		count <<= 1;
+		simd32_fill(b, h, variant);
+		start = clock();
+		ticks = SIMD_TICKS();
+		for (i = 0; i < count; i++)
+			simd32_run(b, h, variant);
+		ticks = SIMD_TICKS() - ticks;
+	} while (clock() - start < SIMD_BENCH_TIME);
+
+	return (double)ticks / ((double)count * b->lanes * simd32_blocks(variant));
+}
+
+static void simd32_test(const struct simd_hash32 *h, int bench)
+{
+	struct simd_bufs32 b;
+	double scalar = 0;
+	int variant, round;
+
+	simd32_alloc(&b, h);
+
+	start_test(h->name);
+	for (variant = 0; variant < SIMD32_VARIANTS; variant++) {
+		if (variant == SIMD32_FLAT_OUT && !h->flat_out)
+			continue;
+		for (round = 0; round < 16; round++) {
+			simd32_fill(&b, h, variant);
+			simd32_run(&b, h, variant);
+			simd32_check(&b, h, variant);
+		}
+	}
+	end_test();
+
+	if (bench) {
+		scalar = simd_bench_scalar(h->ref_blocks, 64);
+		simd_report(h->name, "scalar", scalar, 0);
+		for (variant = 0; variant < SIMD32_VARIANTS; variant++)
+			if (variant != SIMD32_FLAT_OUT || h->flat_out)
+				simd_report(h->name, simd32_variant[variant],
+				            simd32_bench(&b, h, variant), scalar);
+	}
+
+	simd32_free(&b);
+}
+
+#ifdef SIMD_COEF_64
+/*
+ * SHA-384 and SHA-512: 64-bit words, 128 byte blocks, and more entry points.
+ */
+#define SIMD64_LANES		(SIMD_COEF_64 * SIMD_PARA_SHA512)
+
+enum {
+	SIMD64_MIXED,
+	SIMD64_FLAT_OUT,
+	SIMD64_RELOAD,
+	SIMD64_INP_FMT,
+	SIMD64_2BUF,
+	SIMD64_HALF,
+	SIMD64_LOOP,
+	SIMD64_HALF_LOOP,
+	SIMD64_HALF_LOOP_FLAT,
+	SIMD64_VARIANTS
+};
+
+static const char *simd64_variant[SIMD64_VARIANTS] = {
+	"mixed", "flat-out", "reload", "reload-inp-fmt", "flat-2buf",
+	"half", "loop", "half-loop", "half-loop-flat"
+};
+
+struct simd_hash64 {
+	const char *name;
+	void (*ref)(unsigned char *, const unsigned char *, size_t);
+	void (*ref_blocks)(const unsigned char *, size_t, unsigned int);
+	unsigned int digest_size, flags;
+	int variants;	/* SHA-384 lacks the half-block and loop ones */
+};
+
+struct simd_bufs64 {
+	unsigned char msg[SIMD64_LANES][256];
+	size_t len[SIMD64_LANES];
+	uint64_t *mixed[2], *half, *tmp, *out, *loop_out, count;
+	unsigned char *flat;
+};
+
+static int simd64_blocks(int variant)
+{
+	switch (variant) {
+	case SIMD64_RELOAD:
+	case SIMD64_INP_FMT:
+	case SIMD64_2BUF:
+		return 2;
+	case SIMD64_LOOP:
+	case SIMD64_HALF_LOOP:
+	case SIMD64_HALF_LOOP_FLAT:
+		return SIMD_LOOP_COUNT;
+	}
+	return 1;
+}
+
+static void simd64_alloc(struct simd_bufs64 *b)
+{
+	b->mixed[0] = mem_alloc_align(SIMD64_LANES * 128, MEM_ALIGN_SIMD);
+	b->mixed[1] = mem_alloc_align(SIMD64_LANES * 128, MEM_ALIGN_SIMD);
+	b->half = mem_alloc_align(SIMD64_LANES * 64, MEM_ALIGN_SIMD);
+	b->tmp = mem_alloc_align(SIMD64_LANES * 128, MEM_ALIGN_SIMD);
+	b->out = mem_alloc_align(SIMD64_LANES * 128, MEM_ALIGN_SIMD);
+	b->loop_out = mem_alloc_align(SIMD_LOOP_COUNT * SIMD64_LANES * 64,
+		MEM_ALIGN_SIMD);
+	b->flat = mem_alloc_align(SIMD64_LANES * 256, MEM_ALIGN_SIMD);
+}
+
+static void simd64_free(struct simd_bufs64 *b)
+{
+	MEM_FREE(b->mixed[0]);
+	MEM_FREE(b->mixed[1]);
+	MEM_FREE(b->half);
+	MEM_FREE(b->tmp);
+	MEM_FREE(b->out);
+	MEM_FREE(b->loop_out);
+	MEM_FREE(b->flat);
+}
+
+static void simd64_fill(struct simd_bufs64 *b, int variant)
+{
+	int blocks = variant == SIMD64_RELOAD || variant == SIMD64_INP_FMT ||
+		variant == SIMD64_2BUF ? 2 : 1;
+	unsigned int lane, i, j;
+
+	for (lane = 0; lane < SIMD64_LANES; lane++) {
+		unsigned char padded[256];
+
+		/* Half-block and loop variants hash a 64 byte message */
+		if (variant >= SIMD64_HALF)
+			b->len[lane] = 64;
+		else if (blocks == 1)
+			b->len[lane] = simd_random() % 112;
+		else
+			b->len[lane] = 112 + simd_random() % 128;
+		for (i = 0; i < b->len[lane]; i++)
+			b->msg[lane][i] = simd_random();
+		simd_pad(padded, b->msg[lane], b->len[lane], 128, blocks, 1);
+
+		for (i = 0; i < blocks; i++)
+			for (j = 0; j < 16; j++)
+				b->mixed[i][SIMD_IDX(lane, j, 16, SIMD_COEF_64)] =
+					simd_get64(&padded[128 * i + 8 * j]);
+		for (j = 0; j < 8; j++)
+			b->half[SIMD_IDX(lane, j, 8, SIMD_COEF_64)] =
+				simd_get64(&padded[8 * j]);
+		memcpy(&b->flat[256 * lane], padded, 128 * blocks);
+	}
+}
+
+static void simd64_run(struct simd_bufs64 *b, const struct simd_hash64 *h,
+	int variant)
+{
+	unsigned int f = h->flags;
+
+	switch (variant) {
+	case SIMD64_MIXED:
+		SIMDSHA512body(b->mixed[0], b->out, NULL, f);
+		break;
+	case SIMD64_FLAT_OUT:
+		SIMDSHA512body(b->mixed[0], b->out, NULL, f | SSEi_FLAT_OUT);
+		break;
+	case SIMD64_RELOAD:
+		SIMDSHA512body(b->mixed[0], b->out, NULL, f);
+		SIMDSHA512body(b->mixed[1], b->out, b->out, f | SSEi_RELOAD);
+		break;
+	case SIMD64_INP_FMT:
+		SIMDSHA512body(b->mixed[0], b->tmp, NULL,
+		               f | SSEi_OUTPUT_AS_INP_FMT);
+		SIMDSHA512body(b->mixed[1], b->out, b->tmp,
+		               f | SSEi_RELOAD_INP_FMT);
+		break;
+	case SIMD64_2BUF:
+		SIMDSHA512body(b->flat, b->out, NULL,
+		               f | SSEi_FLAT_IN | SSEi_2BUF_INPUT_FIRST_BLK);
+		SIMDSHA512body(b->flat + 128, b->out, b->out, f | SSEi_FLAT_IN |
+		               SSEi_2BUF_INPUT_FIRST_BLK | SSEi_RELOAD);
+		break;
+	case SIMD64_HALF:
+		SIMDSHA512body(b->half, b->out, NULL, SSEi_HALF_IN);
+		break;
+	case SIMD64_LOOP:
+		b->count = SIMD_LOOP_COUNT;
+		SIMDSHA512body(b->mixed[0], b->out, &b->count,
+		               SSEi_MIXED_IN | SSEi_LOOP);
+		break;
+	case SIMD64_HALF_LOOP:
+		b->count = SIMD_LOOP_COUNT;
+		SIMDSHA512body(b->half, b->out, &b->count,
+		               SSEi_HALF_IN | SSEi_LOOP);
+		break;
+	case SIMD64_HALF_LOOP_FLAT:
+		SIMDSHA512body(b->half, b->loop_out,
+		               b->loop_out + SIMD_LOOP_COUNT * SIMD64_LANES * 8,
+		               SSEi_HALF_IN | SSEi_LOOP | SSEi_FLAT_OUT);
+		break;
+	}
+}
+
+static void simd64_check(struct simd_bufs64 *b, const struct simd_hash64 *h,
+	int variant)
+{
+	unsigned char expected[64], computed[64];
+	unsigned int lane, j, stride, iter, iters = 1;
+
+	if (variant >= SIMD64_LOOP)
+		iters = SIMD_LOOP_COUNT;
+
+	/* Which layout the state ends up in */
+	switch (variant) {
+	case SIMD64_LOOP:
+		stride = SIMD_PARA_SHA512 > 1 ? 16 : 8;
+		break;
+	default:
+		stride = 8;
+	}
+
+	for (lane = 0; lane < SIMD64_LANES; lane++) {
+		inc_test();
+		h->ref(expected, b->msg[lane], b->len[lane]);
+		for (iter = 1; iter <= iters; iter++) {
+			if (iter > 1)
+				h->ref(expected, expected, 64);
+			if (variant == SIMD64_HALF_LOOP_FLAT) {
+				for (j = 0; j < 8; j++)
+					simd_put64(&computed[8 * j], b->loop_out[
+					           ((iter - 1) * SIMD64_LANES + lane) * 8 + j]);
+			} else if (iter < iters)
+				continue;
+			else if (variant == SIMD64_FLAT_OUT)
+				memcpy(computed, &b->out[lane * 8], h->digest_size);
+			else
+				for (j = 0; j < 8; j++)
+					simd_put64(&computed[8 * j], b->out[SIMD_IDX(lane, j,
+					           stride, SIMD_COEF_64)]);
+			if (memcmp(expected, computed, h->digest_size)) {
+				simd_error(simd64_variant[variant], lane, b->msg[lane],
+				           b->len[lane], expected, computed,
+				           h->digest_size);
+				break;
+			}
+		}
+	}
+}
+
+static double simd64_bench(struct simd_bufs64 *b, const struct simd_hash64 *h,
+	int variant)
+{
+	unsigned int count = 1, i;
+	uint64_t ticks;
+	clock_t start;
+
+	do {
+		count <<= 1;
+		simd64_fill(b, variant);
+		start = clock();
+		ticks = SIMD_TICKS();
+		for (i = 0; i < count; i++)
+			simd64_run(b, h, variant);
+		ticks = SIMD_TICKS() - ticks;
+	} while (clock() - start < SIMD_BENCH_TIME);
+
+	return (double)ticks /
+		((double)count * SIMD64_LANES * simd64_blocks(variant));
+}
+
+static void simd64_test(const struct simd_hash64 *h, int bench)
+{
+	struct simd_bufs64 *b = mem_alloc(sizeof(*b));
+	double scalar = 0;
+	int variant, round;
+
+	simd64_alloc(b);
+
+	start_test(h->name);
+	for (variant = 0; variant < h->variants; variant++)
+		for (round = 0; round < 16; round++) {
+			simd64_fill(b, variant);
+			simd64_run(b, h, variant);
+			simd64_check(b, h, variant);
+		}
+	end_test();
+
+	if (bench) {
+		scalar = simd_bench_scalar(h->ref_blocks, 128);
+		simd_report(h->name, "scalar", scalar, 0);
+		for (variant = 0; variant < h->variants; variant++)
+			simd_report(h->name, simd64_variant[variant],
+			            simd64_bench(b, h, variant), scalar);
+	}
+
+	simd64_free(b);
+	MEM_FREE(b);
+}
+
+/*
+ * Multi-buffer kernels, hashing SIMD_COEF_64 whole messages of their own
+ * lengths per call.  Each round gives every lane a random length of up to
+ * three blocks, so lanes finish at different blocks.
+ */
+typedef void (*simd_multi)(const unsigned char * const *in, const int *len,
+	unsigned char * const *out, unsigned int outlen);
+
+struct simd_hash_multi {
+	const char *name;
+	simd_multi multi;
+	void (*ref)(unsigned char *, const unsigned char *, size_t);
+	unsigned int block_size, digest_size;
+};
+
+#define SIMD_MULTI_MAX		(3 * 136) /* Keccak-256 blocks */
+
+static void simd_ref_blake2b(unsigned char *digest, const unsigned char *msg,
+	size_t len)
+{
+	blake2b(digest, 64, msg, len, NULL, 0);
+}
+
+static void simd_ref_keccak(unsigned char *digest, const unsigned char *msg,
+	size_t len, unsigned int rate, unsigned int size, unsigned char suffix)
+{
+	Keccak_HashInstance hash;
+
+	Keccak_HashInitialize(&hash, rate * 8, 1600 - rate * 8, size * 8, suffix);
+	Keccak_HashUpdate(&hash, msg, len * 8);
+	Keccak_HashFinal(&hash, digest);
+}
+
+static void simd_ref_keccak256(unsigned char *digest, const unsigned char *msg,
+	size_t len)
+{
+	simd_ref_keccak(digest, msg, len, 136, 32, 0x01);
+}
+
+static void simd_ref_sha3_512(unsigned char *digest, const unsigned char *msg,
+	size_t len)
+{
+	simd_ref_keccak(digest, msg, len, 72, 64, 0x06);
+}
+
+static void simd_keccak256(const unsigned char * const *in, const int *len,
+	unsigned char * const *out, unsigned int outlen)
+{
+	SIMDKeccak(in, len, out, 136, outlen, 0x01);
+}
+
+static void simd_sha3_512(const unsigned char * const *in, const int *len,
+	unsigned char * const *out, unsigned int outlen)
+{
+	SIMDKeccak(in, len, out, 72, outlen, 0x06);
+}
+
+static void simd_multi_run(const struct simd_hash_multi *h,
+	unsigned char (*msg)[SIMD_MULTI_MAX], int *len,
+	unsigned char (*digest)[64])
+{
+	const unsigned char *in[SIMD_COEF_64];
+	unsigned char *out[SIMD_COEF_64];
+	int lane;
+
+	for (lane = 0; lane < SIMD_COEF_64; lane++) {
+		in[lane] = msg[lane];
+		out[lane] = digest[lane];
+	}
+	h->multi(in, len, out, h->digest_size);
+}
+
+/*
+ * Time per message and lane, for messages of a single block.
+ */
+static double simd_multi_bench(const struct simd_hash_multi *h, int scalar,
+	unsigned char (*msg)[SIMD_MULTI_MAX], int *len,
+	unsigned char (*digest)[64])
+{
+	unsigned int count = 1, i, lane;
+	uint64_t ticks;
+	clock_t start;
+
+	for (lane = 0; lane < SIMD_COEF_64; lane++)
+		len[lane] = h->block_size - 17;
+
+	do {
+		count <<= 1;
+		start = clock();
+		ticks = SIMD_TICKS();
+		for (i = 0; i < count; i++)
+			if (scalar)
+				for (lane = 0; lane < SIMD_COEF_64; lane++)
+					h->ref(digest[lane], msg[lane], len[lane]);
+			else
+				simd_multi_run(h, msg, len, digest);
+		ticks = SIMD_TICKS() - ticks;
+	} while (clock() - start < SIMD_BENCH_TIME);
+
+	return (double)ticks / ((double)count * SIMD_COEF_64);
+}
+
+static void simd_multi_test(const struct simd_hash_multi *h, int bench)
+{
+	unsigned char (*msg)[SIMD_MULTI_MAX] =
+		mem_alloc(SIMD_COEF_64 * sizeof(*msg));
+	unsigned char digest[SIMD_COEF_64][64], expected[64];
+	int len[SIMD_COEF_64];
+	unsigned int lane, round, i;
+	double scalar;
+
+	start_test(h->name);
+	for (round = 0; round < 64; round++) {
+		for (lane = 0; lane < SIMD_COEF_64; lane++) {
+			len[lane] = simd_random() % (3 * h->block_size + 1);
+			for (i = 0; i < len[lane]; i++)
+				msg[lane][i] = simd_random();
+		}
+		simd_multi_run(h, msg, len, digest);
+		for (lane = 0; lane < SIMD_COEF_64; lane++) {
+			inc_test();
+			h->ref(expected, msg[lane], len[lane]);
+			if (memcmp(expected, digest[lane], h->digest_size)) {
+				simd_error("multi", lane, msg[lane], len[lane],
+				           expected, digest[lane], h->digest_size);
+				break;
+			}
+		}
+	}
+	end_test();
+
+	if (bench) {
+		scalar = simd_multi_bench(h, 1, msg, len, digest);
+		simd_report(h->name, "scalar", scalar, 0);
+		simd_report(h->name, "multi",
+		            simd_multi_bench(h, 0, msg, len, digest), scalar);
+	}
+
+	MEM_FREE(msg);
+}
+#endif /* SIMD_COEF_64 */
+
+void test_simd_intrinsics()
+{
+	/* MD4 and MD5 only have flat output with USE_EXPERIMENTAL */
+	static const struct simd_hash32 hashes32[] = {
+		{ "SIMDmd4body", SIMDmd4body, simd_ref_md4, simd_ref_blocks_md4,
+		  SIMD_PARA_MD4, 4, 16, 0, 0, 0 },
+		{ "SIMDmd5body", SIMDmd5body, simd_ref_md5, simd_ref_blocks_md5,
+		  SIMD_PARA_MD5, 4, 16, 0, 0, 0 },
+		{ "SIMDSHA1body", SIMDSHA1body, simd_ref_sha1, simd_ref_blocks_sha1,
+		  SIMD_PARA_SHA1, 5, 20, 0, 1, 1 },
+		{ "SIMDSHA256body/224", SIMDSHA256body, simd_ref_sha224,
+		  simd_ref_blocks_sha224, SIMD_PARA_SHA256, 8, 28,
+		  SSEi_CRYPT_SHA224, 1, 1 },
+		{ "SIMDSHA256body", SIMDSHA256body, simd_ref_sha256,
+		  simd_ref_blocks_sha256, SIMD_PARA_SHA256, 8, 32, 0, 1, 1 },
+	};
+#ifdef SIMD_COEF_64
+	static const struct simd_hash64 hashes64[] = {
+		{ "SIMDSHA512body/384", simd_ref_sha384, simd_ref_blocks_sha384,
+		  48, SSEi_CRYPT_SHA384, SIMD64_HALF },
+		{ "SIMDSHA512body", simd_ref_sha512, simd_ref_blocks_sha512,
+		  64, 0, SIMD64_VARIANTS },
+	};
+	static const struct simd_hash_multi hashes_multi[] = {
+		{ "SIMDBlake2b", SIMDBlake2b, simd_ref_blake2b, 128, 64 },
+		{ "SIMDKeccak/256", simd_keccak256, simd_ref_keccak256, 136, 32 },
+		{ "SIMDKeccak/SHA3-512", simd_sha3_512, simd_ref_sha3_512, 72, 64 },
+	};
+#endif
+	unsigned int i;
+
+	printf("  %s, interleaving MD4:%d MD5:%d SHA1:%d SHA256:%d SHA512:%d, "
+	       "benchmarks in %s per block and lane\n", SIMD_TYPE,
+	       SIMD_PARA_MD4, SIMD_PARA_MD5, SIMD_PARA_SHA1, SIMD_PARA_SHA256,
+	       SIMD_PARA_SHA512, SIMD_TICK_UNIT);
+
+	/* Not benchmarking the SHA-224 and SHA-384 flavors */
+	for (i = 0; i < sizeof(hashes32) / sizeof(hashes32[0]); i++)
+		simd32_test(&hashes32[i], !hashes32[i].flags);
+#ifdef SIMD_COEF_64
+	for (i = 0; i < sizeof(hashes64) / sizeof(hashes64[0]); i++)
+		simd64_test(&hashes64[i], !hashes64[i].flags);
+	for (i = 0; i < sizeof(hashes_multi) / sizeof(hashes_multi[0]); i++)
+		simd_multi_test(&hashes_multi[i], 1);
+#endif
+}
+
+#else
+
+void test_simd_intrinsics()
+{
+	printf("  Not a SIMD build, nothing to test\n");
+}
+
+#endif /* SIMD_COEF_32 */
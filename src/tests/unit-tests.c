@@ -8,7 +8,7 @@
 //	memory.c    (??)
 //	unicode.c	(??)
 //	unicode_range.c (??)
-//	simd-intrinsics.c (??)
+//	simd-intrinsics.c (done, with benchmarks)
 //
 //  Likely could add tests for all hash types (or many).  Things like md2/4/5
 //	sha/1/224/..512  sha3, etc, etc. These would be very fast set of known
@@ -2443,6 +2443,9 @@ void test_sha2_c() {
 /* Tests for unicode.c */
 #include "test_valid_utf8.c"
 
+/* Tests and benchmarks for simd-intrinsics.c */
+#include "test_simd_intrinsics.c"
+
 int main() {
 	start_of_run = clock();
 
@@ -2500,6 +2503,9 @@ int main() {
 	set_unit_test_source("unicode.c");
 	test_valid_utf8();
 
+	set_unit_test_source("simd-intrinsics.c");
+	test_simd_intrinsics();
+
 	// perform dump listing of all processed functions.
 	dump_stats();
 
@@ -0,0 +1 @@
+#define JTR_GIT_VERSION JUMBO_VERSION "-fa6d657796" " 2026-10-19 08:55:16 +0000"